@@ -0,0 +1,357 @@
+// benchmark.cpp : Abstraction penalty benchmarks; each kernel is written once and run over neounit quantities and over raw double.
+//
+// usage: benchmark [tolerance (default 0.05)] [elements (default 65536)] [runs (default 200)] [trials (default 7)]
+// Returns a non-zero exit code if a gated kernel is more than tolerance slower over quantities than over raw double
+// beyond the noise of the measurement: the penalty is the median over trials and the noise three times the median
+// absolute deviation of the trials, so a single disturbed trial neither fails nor passes a kernel. The serialization
+// rows compare the wire format with the same values as a JSON array of numbers and fail if the wire format is not at
+// least ten times faster.
+// Build with optimization (e.g. -O2) as the comparison is meaningless otherwise. On Intel cores with the jump conditional
+// code erratum also build with -Wa,-mbranches-within-32B-boundaries: the quantity and raw loops compile to the same
+// instructions but one of them can be placed across a 32 byte boundary and run up to 50% slower for that alone.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
+#include <charconv>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <functional>
+#include <neounit/neounit.hpp>
+#include <neounit/imperial.hpp>
+#include <neounit/ode.hpp>
+#include <neounit/wire.hpp>
+
+namespace
+{
+    using namespace neounit;
+    using namespace neounit::si;
+
+    void const* volatile tSink;
+
+    template <typename T>
+    void escape(T const& aValue)
+    {
+        tSink = &aValue;
+    }
+
+    struct result
+    {
+        double nsPerOp;
+        double gigabytesPerSecond;
+    };
+
+    struct results
+    {
+        result quantity;
+        result raw;
+        double penalty;
+        double noise;
+    };
+
+    double median(std::vector<double> aValues)
+    {
+        std::sort(aValues.begin(), aValues.end());
+        auto const middle = aValues.size() / 2u;
+        return aValues.size() % 2u != 0u ? aValues[middle] : (aValues[middle - 1u] + aValues[middle]) / 2.0;
+    }
+
+    // The two forms of a kernel are run alternately and the best time of each is kept so that
+    // frequency scaling and other machine noise affect both equally. This is repeated for a number of
+    // trials; the best times are reported and the penalty is the median of the trials' penalties.
+    template <typename QuantityKernel, typename RawKernel>
+    results measure(QuantityKernel aQuantityKernel, RawKernel aRawKernel, std::size_t aElements, std::size_t aBytesPerElement, std::size_t aRuns, std::size_t aTrials)
+    {
+        auto time = [](auto& aKernel)
+        {
+            auto const start = std::chrono::steady_clock::now();
+            aKernel();
+            return std::chrono::steady_clock::now() - start;
+        };
+        aQuantityKernel();
+        aRawKernel();
+        auto bestQuantity = std::chrono::steady_clock::duration::max();
+        auto bestRaw = std::chrono::steady_clock::duration::max();
+        std::vector<double> penalties;
+        for (std::size_t trial = 0; trial < std::max<std::size_t>(aTrials, 1u); ++trial)
+        {
+            auto trialQuantity = std::chrono::steady_clock::duration::max();
+            auto trialRaw = std::chrono::steady_clock::duration::max();
+            for (std::size_t run = 0; run < aRuns; ++run)
+            {
+                trialQuantity = std::min(trialQuantity, time(aQuantityKernel));
+                trialRaw = std::min(trialRaw, time(aRawKernel));
+            }
+            penalties.push_back(std::chrono::duration<double>(trialQuantity) / std::chrono::duration<double>(trialRaw) - 1.0);
+            bestQuantity = std::min(bestQuantity, trialQuantity);
+            bestRaw = std::min(bestRaw, trialRaw);
+        }
+        auto const penalty = median(penalties);
+        std::vector<double> deviations;
+        for (auto const trialPenalty : penalties)
+            deviations.push_back(std::abs(trialPenalty - penalty));
+        auto to_result = [&](std::chrono::steady_clock::duration aBest) -> result
+        {
+            auto const ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(aBest).count());
+            return { ns / aElements, static_cast<double>(aElements * aBytesPerElement) / ns };
+        };
+        return { to_result(bestQuantity), to_result(bestRaw), penalty, 3.0 * median(deviations) };
+    }
+
+    template <typename T>
+    std::vector<T> make_data(std::size_t aElements, double aSeed)
+    {
+        std::vector<T> data;
+        data.reserve(aElements);
+        for (std::size_t i = 0; i < aElements; ++i)
+            data.push_back(T{ aSeed + static_cast<double>(i % 1000) * 0.001 });
+        return data;
+    }
+
+    // kernels
+
+    template <typename Length>
+    void axpy(std::vector<Length> const& aX, std::vector<Length> const& aY, std::vector<Length>& aResult)
+    {
+        for (std::size_t i = 0; i < aX.size(); ++i)
+            aResult[i] = aX[i] * 2.5 + aY[i] - aX[i] / 4.0;
+        escape(aResult);
+    }
+
+    template <typename Length, typename Time, typename Speed>
+    void speed(std::vector<Length> const& aDistance, std::vector<Time> const& aTime, std::vector<Speed>& aResult)
+    {
+        for (std::size_t i = 0; i < aDistance.size(); ++i)
+            aResult[i] = aDistance[i] / aTime[i];
+        escape(aResult);
+    }
+
+    template <typename Force, typename Length, typename Energy>
+    void work(std::vector<Force> const& aForce, std::vector<Length> const& aDistance, std::vector<Energy>& aResult)
+    {
+        for (std::size_t i = 0; i < aForce.size(); ++i)
+            aResult[i] = aForce[i] * aDistance[i];
+        escape(aResult);
+    }
+
+    template <typename From, typename To, typename Convert>
+    void convert(std::vector<From> const& aInput, std::vector<To>& aResult, Convert aConvert)
+    {
+        for (std::size_t i = 0; i < aInput.size(); ++i)
+            aResult[i] = aConvert(aInput[i]);
+        escape(aResult);
+    }
+
+    template <typename Length>
+    void compare(std::vector<Length> const& aX, std::vector<Length> const& aY, std::size_t& aResult)
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < aX.size(); ++i)
+            count += (aX[i] < aY[i]) ? 1u : 0u;
+        aResult = count;
+        escape(aResult);
+    }
+
+    using velocity_type = decltype(metre{} / second{});
+
+    struct oscillator
+    {
+        metre position;
+        velocity_type velocity;
+    };
+
+    struct oscillator_rate
+    {
+        velocity_type velocity;
+        decltype(velocity_type{} / second{}) acceleration;
+    };
+
+    void oscillate(state_array<oscillator>& aStates)
+    {
+        aStates.rk4([](second, oscillator const& aState) { return oscillator_rate{ aState.velocity, aState.position / (second{ 1.0 } * second{ 1.0 }) * -1.0 }; },
+            second{ 0.0 }, millisecond{ 1.0 }, 1u);
+        escape(aStates);
+    }
+
+    // the same RK4 step written by hand over raw position and velocity arrays
+    void oscillate(std::vector<double>& aPositions, std::vector<double>& aVelocities)
+    {
+        double const h = 1.0e-3;
+        auto const positions = aPositions.data();
+        auto const velocities = aVelocities.data();
+        for (std::size_t i = 0; i < aPositions.size(); ++i)
+        {
+            double const x = positions[i];
+            double const v = velocities[i];
+            double const k1x = v, k1v = -x;
+            double const k2x = v + h * 0.5 * k1v, k2v = -(x + h * 0.5 * k1x);
+            double const k3x = v + h * 0.5 * k2v, k3v = -(x + h * 0.5 * k2x);
+            double const k4x = v + h * k3v, k4v = -(x + h * k3x);
+            positions[i] = x + h * (k1x * (1.0 / 6.0) + k2x * (1.0 / 3.0) + k3x * (1.0 / 3.0) + k4x * (1.0 / 6.0));
+            velocities[i] = v + h * (k1v * (1.0 / 6.0) + k2v * (1.0 / 3.0) + k3v * (1.0 / 3.0) + k4v * (1.0 / 6.0));
+        }
+        escape(aPositions);
+    }
+
+    template <typename Render>
+    void render(std::vector<double> const& aValues, std::size_t aCount, std::string& aResult, Render aRender)
+    {
+        aResult.clear();
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult += aRender(aValues[i]);
+        escape(aResult);
+    }
+
+    // shortest round trip text, the best case for a text format
+    void write_json(std::vector<double> const& aValues, std::string& aResult)
+    {
+        aResult.resize(aValues.size() * 25u + 2u);
+        auto output = aResult.data();
+        auto const end = aResult.data() + aResult.size();
+        *output++ = '[';
+        for (std::size_t i = 0; i < aValues.size(); ++i)
+        {
+            if (i != 0u)
+                *output++ = ',';
+            output = std::to_chars(output, end, aValues[i]).ptr;
+        }
+        *output++ = ']';
+        aResult.resize(static_cast<std::size_t>(output - aResult.data()));
+        escape(aResult);
+    }
+
+    void read_json(std::string const& aInput, std::vector<double>& aResult)
+    {
+        auto input = aInput.data() + 1;
+        auto const end = aInput.data() + aInput.size();
+        for (std::size_t i = 0; i < aResult.size() && input < end; ++i)
+            input = std::from_chars(input, end, aResult[i]).ptr + 1;
+        escape(aResult);
+    }
+
+    struct report
+    {
+        double tolerance;
+        bool failed = false;
+
+        void add(std::string const& aName, results const& aResults, bool aGated = true)
+        {
+            auto const& quantity = aResults.quantity;
+            auto const& raw = aResults.raw;
+            auto const penalty = aResults.penalty;
+            bool const fail = aGated && penalty - aResults.noise > tolerance;
+            failed = failed || fail;
+            std::cout << std::left << std::setw(28) << aName << std::right << std::fixed << std::setprecision(3)
+                << std::setw(10) << quantity.nsPerOp << std::setw(10) << raw.nsPerOp
+                << std::setw(10) << quantity.gigabytesPerSecond << std::setw(10) << raw.gigabytesPerSecond
+                << std::setw(9) << std::setprecision(1) << penalty * 100.0 << "%"
+                << std::setw(7) << aResults.noise * 100.0 << "%"
+                << (fail ? "  FAIL" : aGated ? "" : "  (not gated)") << std::endl;
+        }
+        // The first kernel of aResults against the second as a speedup, failing if it is less than aMinimum.
+        void add_speedup(std::string const& aName, results const& aResults, double aMinimum)
+        {
+            auto const speedup = 1.0 / (1.0 + aResults.penalty);
+            bool const fail = 1.0 / (1.0 + aResults.penalty - aResults.noise) < aMinimum;
+            failed = failed || fail;
+            std::cout << std::left << std::setw(28) << aName << std::right << std::fixed << std::setprecision(3)
+                << std::setw(10) << aResults.quantity.nsPerOp << std::setw(10) << aResults.raw.nsPerOp
+                << std::setw(10) << aResults.quantity.gigabytesPerSecond << std::setw(10) << aResults.raw.gigabytesPerSecond
+                << std::setw(9) << std::setprecision(1) << speedup << "x"
+                << std::setw(7) << aResults.noise * 100.0 << "%"
+                << (fail ? "  FAIL" : "") << std::endl;
+        }
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    double const tolerance = argc > 1 ? std::atof(argv[1]) : 0.05;
+    std::size_t const elements = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 65536u;
+    std::size_t const runs = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 200u;
+    std::size_t const trials = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 7u;
+
+    using speed_type = decltype(metre{} / second{});
+    using energy_type = decltype(newton{} * metre{});
+
+    auto const x = make_data<metre>(elements, 1.0);
+    auto const y = make_data<metre>(elements, 2.0);
+    auto const t = make_data<second>(elements, 3.0);
+    auto const f = make_data<newton>(elements, 4.0);
+    auto const km = make_data<kilometre>(elements, 5.0);
+    auto const miles = make_data<imperial::mile>(elements, 6.0);
+    auto const xRaw = make_data<double>(elements, 1.0);
+    auto const yRaw = make_data<double>(elements, 2.0);
+    auto const tRaw = make_data<double>(elements, 3.0);
+    auto const fRaw = make_data<double>(elements, 4.0);
+    auto const kmRaw = make_data<double>(elements, 5.0);
+    auto const milesRaw = make_data<double>(elements, 6.0);
+
+    std::vector<metre> lengths(elements);
+    std::vector<speed_type> speeds(elements);
+    std::vector<energy_type> energies(elements);
+    std::vector<kilometre> kilometres(elements);
+    std::vector<double> raw(elements);
+    std::size_t count = 0;
+    std::string text;
+
+    report r{ tolerance };
+    std::cout << std::left << std::setw(28) << "kernel" << std::right << std::setw(10) << "ns/op" << std::setw(10) << "raw"
+        << std::setw(10) << "GB/s" << std::setw(10) << "raw" << std::setw(10) << "penalty" << std::setw(8) << "noise" << std::endl;
+
+    auto constexpr d = sizeof(double);
+    r.add("arithmetic (axpy)", measure(
+        [&]() { axpy(x, y, lengths); },
+        [&]() { axpy(xRaw, yRaw, raw); }, elements, 3 * d, runs, trials));
+    r.add("operator/ (m / s)", measure(
+        [&]() { speed(x, t, speeds); },
+        [&]() { speed(xRaw, tRaw, raw); }, elements, 3 * d, runs, trials));
+    r.add("operator* (N * m)", measure(
+        [&]() { work(f, x, energies); },
+        [&]() { work(fRaw, xRaw, raw); }, elements, 3 * d, runs, trials));
+    r.add("conversion_cast (km -> m)", measure(
+        [&]() { convert(km, lengths, [](kilometre aValue) { return conversion_cast<metre>(aValue); }); },
+        [&]() { convert(kmRaw, raw, [](double aValue) { return aValue * 1000.0; }); }, elements, 2 * d, runs, trials));
+    r.add("conversion_cast (mi -> km)", measure(
+        [&]() { convert(miles, kilometres, [](imperial::mile aValue) { return conversion_cast<kilometre>(aValue); }); },
+        [&]() { convert(milesRaw, raw, [](double aValue) { return aValue * 1.609344; }); }, elements, 2 * d, runs, trials));
+    r.add("comparison (m < m)", measure(
+        [&]() { compare(x, y, count); },
+        [&]() { compare(xRaw, yRaw, count); }, elements, 2 * d, runs, trials));
+    state_array<oscillator> oscillators(elements);
+    oscillators.field<0>() = xRaw;
+    std::vector<double> positions = xRaw;
+    std::vector<double> velocities(elements);
+    r.add("ode (rk4 step, SoA)", measure(
+        [&]() { oscillate(oscillators); },
+        [&]() { oscillate(positions, velocities); }, elements, 4 * d, runs, trials));
+    std::size_t const strings = std::max<std::size_t>(elements / 64, 1u);
+    r.add("string rendering", measure(
+        [&]() { render(xRaw, strings, text, [](double aValue) { return std::to_string(aValue) + " " + base_units_to_string(metre{ aValue } / second{ 1.0 }); }); },
+        [&]() { render(xRaw, strings, text, [](double aValue) { return std::to_string(aValue) + " " + std::string{ "m s^-1" }; }); }, strings, d, runs, trials),
+        false);
+
+    // serialization of a column, against JSON text in the raw column
+    std::vector<std::byte> message;
+    std::vector<metre> received(elements);
+    std::string json;
+    std::vector<double> parsed(elements);
+    std::size_t const textRuns = std::max<std::size_t>(runs / 20u, 1u);
+    r.add_speedup("wire encode (vs JSON)", measure(
+        [&]() { message.clear(); write_column(message, std::span<metre const>{ x }); escape(message); },
+        [&]() { write_json(xRaw, json); }, elements, d, textRuns, trials), 10.0);
+    r.add_speedup("wire decode (vs JSON)", measure(
+        [&]() { wire_view<metre>{ message }.copy_to(std::span{ received }); escape(received); },
+        [&]() { read_json(json, parsed); }, elements, d, textRuns, trials), 10.0);
+
+    if (r.failed)
+    {
+        std::cerr << "neounit is more than " << tolerance * 100.0 << "% (beyond noise) slower than raw double for at least one kernel" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,510 @@
+// arrow.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <charconv>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <neounit/neounit.hpp>
+#include <neounit/descriptor.hpp>
+
+// Arrow C data interface (https://arrow.apache.org/docs/format/CDataInterface.html); the guard is the one the
+// specification asks every producer and consumer to use so that the definitions can come from anywhere.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema
+{
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray
+{
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif
+
+namespace neounit
+{
+    // Columns of quantities exchanged through the Arrow C data interface, e.g.
+    //
+    //     ArrowArray array;
+    //     ArrowSchema schema;
+    //     export_arrow(std::move(distances), array, schema, "distance");   // km values, "neounit.unit" = "km"
+    //     ...
+    //     arrow_view<si::metre> metres{ array, schema };                      // converts km to m as it reads
+    //
+    // A column is a primitive array whose data buffer is the values themselves (no copy) and whose schema
+    // metadata holds the unit under the key "neounit.unit" in the form of si::base_units_to_string. Columns
+    // with nulls are not supported.
+
+    constexpr std::string_view arrow_unit_key = "neounit.unit";
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr char const* arrow_format()
+        {
+            if constexpr (std::is_same_v<T, double>)
+                return "g";
+            else if constexpr (std::is_same_v<T, float>)
+                return "f";
+            else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) == 8u)
+                return std::is_signed_v<T> ? "l" : "L";
+            else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) == 4u)
+                return std::is_signed_v<T> ? "i" : "I";
+            else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) == 2u)
+                return std::is_signed_v<T> ? "s" : "S";
+            else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) == 1u)
+                return std::is_signed_v<T> ? "c" : "C";
+            else
+                return nullptr;
+        }
+
+        struct unit_symbol
+        {
+            std::string_view symbol;
+            std::size_t dimension;
+            std::int64_t num;
+            std::int64_t den;
+            std::int64_t exp;
+            std::int64_t exp_pi;
+        };
+
+        template <typename Ratio>
+        constexpr unit_symbol unit_symbol_of(std::string_view aSymbol, si::dimension aDimension)
+        {
+            static_assert(Ratio::exp2 == 0);
+            return { aSymbol, static_cast<std::size_t>(aDimension), Ratio::num, Ratio::den, Ratio::exp, Ratio::exp_pi };
+        }
+
+        // longest first so that e.g. "mol" is not read as milli-"ol"
+        constexpr unit_symbol unit_symbols[] =
+        {
+            unit_symbol_of<si::arcminute_ratio>("arcmin", si::dimension::PlaneAngle),
+            unit_symbol_of<si::arcsecond_ratio>("arcsec", si::dimension::PlaneAngle),
+            unit_symbol_of<one>("mol", si::dimension::AmountOfSubstance),
+            unit_symbol_of<one>("rad", si::dimension::PlaneAngle),
+            unit_symbol_of<ratio<1, 8>>("bit", si::dimension::Information),
+            unit_symbol_of<si::degree_ratio>("deg", si::dimension::PlaneAngle),
+            unit_symbol_of<one>("cd", si::dimension::LuminousIntensity),
+            unit_symbol_of<si::turn_ratio>("tr", si::dimension::PlaneAngle),
+            unit_symbol_of<one>("s", si::dimension::Time),
+            unit_symbol_of<ratio<60 * 60>>("h", si::dimension::Time),
+            unit_symbol_of<one>("m", si::dimension::Length),
+            unit_symbol_of<one>("g", si::dimension::Mass),
+            unit_symbol_of<one>("A", si::dimension::ElectricCurrent),
+            unit_symbol_of<one>("K", si::dimension::AbsoluteTemperature),
+            unit_symbol_of<one>("B", si::dimension::Information)
+        };
+
+        struct unit_prefix
+        {
+            std::string_view prefix;
+            std::int64_t exp;
+            std::int64_t exp2;
+        };
+
+        template <typename Ratio>
+        constexpr unit_prefix unit_prefix_of()
+        {
+            static_assert(Ratio::num == 1 && Ratio::den == 1);
+            return { ratio_short_prefix<Ratio>::prefix, Ratio::exp, Ratio::exp2 };
+        }
+
+        constexpr unit_prefix unit_prefixes[] =
+        {
+            { "", 0, 0 },
+            unit_prefix_of<quecto>(), unit_prefix_of<ronto>(), unit_prefix_of<yocto>(), unit_prefix_of<zepto>(), unit_prefix_of<atto>(),
+            unit_prefix_of<femto>(), unit_prefix_of<pico>(), unit_prefix_of<nano>(), unit_prefix_of<micro>(), unit_prefix_of<milli>(),
+            unit_prefix_of<centi>(), unit_prefix_of<deci>(), unit_prefix_of<deca>(), unit_prefix_of<hecto>(), unit_prefix_of<kilo>(),
+            unit_prefix_of<mega>(), unit_prefix_of<giga>(), unit_prefix_of<tera>(), unit_prefix_of<peta>(), unit_prefix_of<exa>(),
+            unit_prefix_of<zetta>(), unit_prefix_of<yotta>(), unit_prefix_of<ronna>(), unit_prefix_of<quetta>(),
+            unit_prefix_of<kibi>(), unit_prefix_of<mebi>(), unit_prefix_of<gibi>(), unit_prefix_of<tebi>(), unit_prefix_of<pebi>(),
+            unit_prefix_of<exbi>(), unit_prefix_of<zebi>(), unit_prefix_of<yobi>()
+        };
+
+        // Runtime counterpart of ratio arithmetic and normalize_ratio_t; throws if a magnitude does not fit.
+        struct runtime_ratio
+        {
+            std::int64_t num = 1;
+            std::int64_t den = 1;
+            std::int64_t exp = 0;
+            std::int64_t exp2 = 0;
+            std::int64_t exp_pi = 0;
+
+            void multiply(std::int64_t aNum, std::int64_t aDen)
+            {
+                auto const g1 = std::gcd(num, aDen);
+                auto const g2 = std::gcd(aNum, den);
+                auto const lhs = num / g1;
+                auto const rhs = aNum / g2;
+                auto const lhsDen = den / g2;
+                auto const rhsDen = aDen / g1;
+                constexpr auto max = std::numeric_limits<std::int64_t>::max();
+                if (lhs > max / rhs || lhsDen > max / rhsDen)
+                    throw std::invalid_argument("neounit: unit magnitude out of range");
+                num = lhs * rhs;
+                den = lhsDen * rhsDen;
+            }
+            void normalize()
+            {
+                constexpr auto max = std::numeric_limits<std::int64_t>::max();
+                for (; exp2 > 0 && num <= max / 2; --exp2)
+                    multiply(2, 1);
+                for (; exp2 < 0 && den <= max / 2; ++exp2)
+                    multiply(1, 2);
+                for (; num % 10 == 0; ++exp)
+                    num /= 10;
+                for (; den % 10 == 0; --exp)
+                    den /= 10;
+            }
+        };
+    }
+
+    /// Parses a unit in the form written by si::base_units_to_string, e.g. "km h^-1"; throws
+    /// std::invalid_argument if it is not one.
+    inline unit_descriptor unit_descriptor_from_string(std::string_view aUnit)
+    {
+        unit_descriptor result{};
+        detail::runtime_ratio magnitude;
+        while (!aUnit.empty())
+        {
+            auto const end = aUnit.find(' ');
+            auto token = aUnit.substr(0, end);
+            aUnit = end == std::string_view::npos ? std::string_view{} : aUnit.substr(end + 1);
+            if (token.empty())
+                continue;
+            std::int64_t power = 1;
+            if (auto const caret = token.find('^'); caret != std::string_view::npos)
+            {
+                auto const digits = token.substr(caret + 1);
+                auto const parsed = std::from_chars(digits.data(), digits.data() + digits.size(), power);
+                if (parsed.ec != std::errc{} || parsed.ptr != digits.data() + digits.size() || power == 0 || power < -128 || power > 127)
+                    throw std::invalid_argument("neounit::unit_descriptor_from_string: bad exponent");
+                token = token.substr(0, caret);
+            }
+            detail::unit_symbol const* symbol = nullptr;
+            detail::unit_prefix const* prefix = nullptr;
+            for (auto const& s : detail::unit_symbols)
+            {
+                if (token.size() < s.symbol.size() || token.substr(token.size() - s.symbol.size()) != s.symbol)
+                    continue;
+                for (auto const& p : detail::unit_prefixes)
+                    if (p.prefix == token.substr(0, token.size() - s.symbol.size()))
+                        prefix = &p;
+                if (prefix != nullptr)
+                {
+                    symbol = &s;
+                    break;
+                }
+            }
+            if (symbol == nullptr)
+                throw std::invalid_argument("neounit::unit_descriptor_from_string: unknown unit");
+            auto const exponent = result.exponents[symbol->dimension] + power;
+            if (exponent < -128 || exponent > 127)
+                throw std::invalid_argument("neounit::unit_descriptor_from_string: bad exponent");
+            result.exponents[symbol->dimension] = static_cast<std::int8_t>(exponent);
+            for (auto e = power < 0 ? -power : power; e > 0; --e)
+            {
+                if (power > 0)
+                    magnitude.multiply(symbol->num, symbol->den);
+                else
+                    magnitude.multiply(symbol->den, symbol->num);
+            }
+            magnitude.exp += (symbol->exp + prefix->exp) * power;
+            magnitude.exp2 += prefix->exp2 * power;
+            magnitude.exp_pi += symbol->exp_pi * power;
+        }
+        magnitude.normalize();
+        if (magnitude.exp < -32768 || magnitude.exp > 32767 || magnitude.exp2 < -32768 || magnitude.exp2 > 32767 ||
+            magnitude.exp_pi < -32768 || magnitude.exp_pi > 32767)
+            throw std::invalid_argument("neounit: unit magnitude out of range");
+        result.num = magnitude.num;
+        result.den = magnitude.den;
+        result.exp = static_cast<std::int16_t>(magnitude.exp);
+        result.exp2 = static_cast<std::int16_t>(magnitude.exp2);
+        result.exp_pi = static_cast<std::int16_t>(magnitude.exp_pi);
+        return result;
+    }
+
+    namespace detail
+    {
+        struct arrow_schema_data
+        {
+            std::string format;
+            std::string name;
+            std::string metadata;
+        };
+
+        inline void release_arrow_schema(ArrowSchema* aSchema)
+        {
+            delete static_cast<arrow_schema_data*>(aSchema->private_data);
+            aSchema->release = nullptr;
+        }
+
+        template <typename Owner>
+        struct arrow_array_data
+        {
+            void const* buffers[2];
+            Owner owner;
+        };
+
+        template <typename Owner>
+        void release_arrow_array(ArrowArray* aArray)
+        {
+            delete static_cast<arrow_array_data<Owner>*>(aArray->private_data);
+            aArray->release = nullptr;
+        }
+
+        inline void append_int32(std::string& aOutput, std::int32_t aValue)
+        {
+            char bytes[sizeof(aValue)];
+            std::memcpy(bytes, &aValue, sizeof(aValue));
+            aOutput.append(bytes, sizeof(aValue));
+        }
+
+        inline std::string arrow_metadata(std::string_view aUnit)
+        {
+            std::string result;
+            append_int32(result, 1);
+            append_int32(result, static_cast<std::int32_t>(arrow_unit_key.size()));
+            result += arrow_unit_key;
+            append_int32(result, static_cast<std::int32_t>(aUnit.size()));
+            result += aUnit;
+            return result;
+        }
+
+        struct arrow_no_owner {};
+
+        template <typename Quantity, typename Owner>
+        inline void export_arrow(Quantity const* aData, std::size_t aSize, Owner&& aOwner, ArrowArray& aArray, ArrowSchema& aSchema, std::string_view aName)
+        {
+            using value_type = typename Quantity::value_type;
+            static_assert(arrow_format<value_type>() != nullptr, "neounit::export_arrow: unsupported value type");
+            static_assert(sizeof(Quantity) == sizeof(value_type), "neounit::export_arrow: unsupported value type");
+            auto const unit = si::base_units_to_string(Quantity{});
+            if (unit_descriptor_from_string(unit) != descriptor_of<Quantity>())
+                throw std::invalid_argument("neounit::export_arrow: unit has no exact base unit string");
+            auto schemaData = std::make_unique<arrow_schema_data>(arrow_schema_data{ arrow_format<value_type>(), std::string{ aName }, arrow_metadata(unit) });
+            auto arrayData = std::make_unique<arrow_array_data<std::decay_t<Owner>>>(arrow_array_data<std::decay_t<Owner>>{ { nullptr, aData }, std::forward<Owner>(aOwner) });
+            // the owner may have been moved so the data pointer is taken from it again
+            if constexpr (!std::is_same_v<std::decay_t<Owner>, arrow_no_owner>)
+                arrayData->buffers[1] = arrayData->owner.data();
+            aSchema = { schemaData->format.c_str(), schemaData->name.c_str(), schemaData->metadata.data(), 0, 0, nullptr, nullptr, &release_arrow_schema, schemaData.get() };
+            aArray = { static_cast<int64_t>(aSize), 0, 0, 2, 0, arrayData->buffers, nullptr, nullptr, &release_arrow_array<std::decay_t<Owner>>, arrayData.get() };
+            schemaData.release();
+            arrayData.release();
+        }
+    }
+
+    /// Exports aValues without copying; they must outlive the exported array (until its release callback is
+    /// called). Throws std::invalid_argument if the unit cannot be named exactly by si::base_units_to_string
+    /// (e.g. miles, which it writes as "m").
+    template <typename Quantity, std::size_t Extent>
+    inline void export_arrow(std::span<Quantity const, Extent> aValues, ArrowArray& aArray, ArrowSchema& aSchema, std::string_view aName = {})
+    {
+        detail::export_arrow(aValues.data(), aValues.size(), detail::arrow_no_owner{}, aArray, aSchema, aName);
+    }
+
+    /// Exports aValues, which the exported array then owns.
+    template <typename Quantity>
+    inline void export_arrow(std::vector<Quantity>&& aValues, ArrowArray& aArray, ArrowSchema& aSchema, std::string_view aName = {})
+    {
+        auto const size = aValues.size();
+        detail::export_arrow(static_cast<Quantity const*>(nullptr), size, std::move(aValues), aArray, aSchema, aName);
+    }
+
+    /// The unit in the metadata of aSchema; throws std::invalid_argument if it has none.
+    inline unit_descriptor arrow_unit(ArrowSchema const& aSchema)
+    {
+        auto read_int32 = [](char const*& aInput)
+        {
+            std::int32_t result;
+            std::memcpy(&result, aInput, sizeof(result));
+            aInput += sizeof(result);
+            return result;
+        };
+        if (aSchema.metadata != nullptr)
+        {
+            auto input = aSchema.metadata;
+            for (auto pairs = read_int32(input); pairs > 0; --pairs)
+            {
+                auto const keySize = read_int32(input);
+                std::string_view const key{ input, static_cast<std::size_t>(keySize) };
+                input += keySize;
+                auto const valueSize = read_int32(input);
+                std::string_view const value{ input, static_cast<std::size_t>(valueSize) };
+                input += valueSize;
+                if (key == arrow_unit_key)
+                    return unit_descriptor_from_string(value);
+            }
+        }
+        throw std::invalid_argument("neounit::arrow_unit: column has no unit");
+    }
+
+    /// The values of an imported column of T; throws std::invalid_argument if it is not a column of T
+    /// without nulls.
+    template <typename T>
+    inline std::span<T const> arrow_values(ArrowArray const& aArray, ArrowSchema const& aSchema)
+    {
+        static_assert(detail::arrow_format<T>() != nullptr, "neounit::arrow_values: unsupported value type");
+        if (aSchema.format == nullptr || std::string_view{ aSchema.format } != detail::arrow_format<T>())
+            throw std::invalid_argument("neounit::arrow_values: value type mismatch");
+        if (aArray.n_buffers != 2 || aArray.n_children != 0 || aArray.length < 0 || aArray.offset < 0)
+            throw std::invalid_argument("neounit::arrow_values: not a primitive array");
+        if (aArray.null_count != 0 && aArray.buffers[0] != nullptr)
+            throw std::invalid_argument("neounit::arrow_values: nulls not supported");
+        if (aArray.length == 0)
+            return {};
+        return { static_cast<T const*>(aArray.buffers[1]) + aArray.offset, static_cast<std::size_t>(aArray.length) };
+    }
+
+    /// An imported column read as values of Quantity. The column may be in any multiple of the unit of
+    /// Quantity: the dimensions are checked when the view is opened and the values are only scaled (by a
+    /// factor computed then) if the units differ. The view does not take ownership of the array.
+    template <typename Quantity>
+    class arrow_view
+    {
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+        static_assert(sizeof(quantity_type) == sizeof(value_type), "neounit::arrow_view: unsupported value type");
+    public:
+        arrow_view(ArrowArray const& aArray, ArrowSchema const& aSchema) :
+            iValues{ arrow_values<value_type>(aArray, aSchema) }, iUnit{ arrow_unit(aSchema) }, iFactor{ static_cast<value_type>(1) }
+        {
+            constexpr unit_descriptor expected = descriptor_of<quantity_type>();
+            if (iUnit != expected)
+            {
+                if (!iUnit.same_dimensions(expected))
+                    throw std::invalid_argument("neounit::arrow_view: incompatible dimensions");
+                if constexpr (std::is_integral_v<value_type>)
+                    throw std::invalid_argument("neounit::arrow_view: integral column in a different unit");
+                else
+                    iFactor = conversion_factor<value_type>(iUnit, expected);
+            }
+        }
+    public:
+        unit_descriptor const& unit() const
+        {
+            return iUnit;
+        }
+        std::size_t size() const
+        {
+            return iValues.size();
+        }
+        bool empty() const
+        {
+            return iValues.empty();
+        }
+        /// True if values are converted as they are read.
+        bool converts() const
+        {
+            return iUnit != descriptor_of<quantity_type>();
+        }
+        quantity_type operator[](std::size_t aIndex) const
+        {
+            if constexpr (std::is_floating_point_v<value_type>)
+                return iValues[aIndex] * iFactor;
+            else
+                return iValues[aIndex];
+        }
+        /// Reads the whole column into aOutput, which must be at least size() values; a copy of the values when
+        /// no conversion is needed.
+        template <std::size_t Extent>
+        void copy_to(std::span<quantity_type, Extent> aOutput) const
+        {
+            if (aOutput.size() < size())
+                throw std::invalid_argument("neounit::arrow_view: output too small");
+            if (!converts())
+            {
+                if (!empty())
+                    std::memcpy(static_cast<void*>(aOutput.data()), iValues.data(), size() * sizeof(value_type));
+            }
+            else
+            {
+                for (std::size_t i = 0; i < size(); ++i)
+                    aOutput[i] = (*this)[i];
+            }
+        }
+        std::vector<quantity_type> to_vector() const
+        {
+            std::vector<quantity_type> result(size());
+            copy_to(std::span{ result });
+            return result;
+        }
+    private:
+        std::span<value_type const> iValues;
+        unit_descriptor iUnit;
+        value_type iFactor;
+    };
+}
@@ -39,23 +39,33 @@
 
 #include <neounit/unit.hpp>
 #include <neounit/si.hpp>
+#include <neounit/si_other.hpp>
 
 namespace neounit::astronomical
 {
     using si::dimension;
 
     template<dimensional_exponent E, typename T = double>
-    using pc = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<30856775814913673, 1>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using pc = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<30856775814913673, 1>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using au = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<149597870700, 1>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using au = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<149597870700, 1>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using ly = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<9460730472580800, 1>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using ly = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<9460730472580800, 1>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
 
     namespace literals
     {
-        inline auto operator "" _pc(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<30856775814913673, 1>, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _au(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<149597870700, 1>, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _ly(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<9460730472580800, 1>, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _pc(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<30856775814913673, 1>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _pc(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<30856775814913673, 1>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _au(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<149597870700, 1>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _au(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<149597870700, 1>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _ly(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<9460730472580800, 1>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _ly(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<9460730472580800, 1>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        namespace exact
+        {
+            template <char... Chars> consteval auto operator "" _pc() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<30856775814913673, 1>, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _au() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<149597870700, 1>, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _ly() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<9460730472580800, 1>, none, none, none, none, none, none, none>>, Chars...>(); }
+        }
     }
 
     using pc_sq = pc<2>;
@@ -82,31 +92,40 @@ namespace neounit::astronomical
 
     #define define_astronomical_prefix(ShortPrefix, Ratio)\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## pc = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## pc = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## au = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## au = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## ly = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
-    using ShortPrefix ## pc_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none>>;\
-    using ShortPrefix ## au_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none>>;\
-    using ShortPrefix ## ly_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none>>;\
-    using inv_ ## ShortPrefix ## pc = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## au = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## ly = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## pc_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## au_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## ly_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using Ratio ## parsec = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none>>;\
-    using Ratio ## astronomicalunit = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none>>;\
-    using Ratio ## lightyear = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none>>;\
-    using inv_ ## Ratio ## parsec = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## astronomicalunit = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## lightyear = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using ShortPrefix ## ly = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## pc_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## au_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## ly_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>>;\
+    using inv_ ## ShortPrefix ## pc = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## au = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## ly = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## pc_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## au_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## ly_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using Ratio ## parsec = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>>;\
+    using Ratio ## astronomicalunit = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>>;\
+    using Ratio ## lightyear = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>>;\
+    using inv_ ## Ratio ## parsec = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## astronomicalunit = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## lightyear = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
     namespace literals\
     {\
-        inline auto operator "" _ ## ShortPrefix ## pc(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## au(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## ly(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## pc(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## pc(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## au(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## au(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## ly(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## ly(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        namespace exact\
+        {\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## pc() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<30856775814913673, 1>, Ratio>, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## au() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<149597870700, 1>, Ratio>, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## ly() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<9460730472580800, 1>, Ratio>, none, none, none, none, none, none, none>>, Chars...>(); }\
+        }\
     }
 
     define_astronomical_prefix(q, quecto)
@@ -133,4 +152,18 @@ namespace neounit::astronomical
     define_astronomical_prefix(Y, yotta)
     define_astronomical_prefix(R, ronna)
     define_astronomical_prefix(Q, quetta)
+
+    /// Distance of a star from its annual parallax: d[pc] = 1 / p[arcsec].
+    template <typename T, typename Ratio>
+    inline pc<1, T> parallax_distance(scalar<T, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, Ratio, none>> const& aParallax)
+    {
+        return static_cast<T>(1.0) / static_cast<T>(conversion_cast<si::arcsec<T>>(aParallax));
+    }
+
+    /// Annual parallax of a star at the given distance: p[arcsec] = 1 / d[pc].
+    template <typename T, typename Ratios>
+    inline si::arcsec<T> parallax(scalar<T, dimension, exponents<m_EXPONENTS(1)>, Ratios> const& aDistance)
+    {
+        return static_cast<T>(1.0) / static_cast<T>(conversion_cast<pc<1, T>>(aDistance));
+    }
 }
\ No newline at end of file
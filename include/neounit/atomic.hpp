@@ -0,0 +1,230 @@
+// atomic.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    namespace detail
+    {
+        // Two 64 byte lines so that adjacent line prefetching does not couple neighbouring shards (and 128 byte
+        // lines on some ARM cores are covered); std::hardware_destructive_interference_size is not ABI stable.
+        constexpr std::size_t cache_line_size = 128u;
+
+        template <typename T>
+        inline T atomic_fetch_add(std::atomic<T>& aTarget, T aDelta, std::memory_order aOrder)
+        {
+#ifdef __cpp_lib_atomic_float
+            return aTarget.fetch_add(aDelta, aOrder);
+#else
+            if constexpr (std::is_integral_v<T>)
+                return aTarget.fetch_add(aDelta, aOrder);
+            else
+            {
+                T expected = aTarget.load(std::memory_order_relaxed);
+                while (!aTarget.compare_exchange_weak(expected, expected + aDelta, aOrder, std::memory_order_relaxed))
+                    ;
+                return expected;
+            }
+#endif
+        }
+
+        // Threads are numbered in the order they first use a sharded accumulator so that consecutive threads
+        // use different shards.
+        inline std::size_t thread_index() noexcept
+        {
+            static std::atomic<std::size_t> sNextIndex;
+            thread_local std::size_t const tIndex = sNextIndex.fetch_add(1u, std::memory_order_relaxed);
+            return tIndex;
+        }
+    }
+
+    /// A quantity that can be updated concurrently. The value is held in a std::atomic of the value type, which
+    /// must be lock-free; fetch_add and fetch_sub accept any quantity with the same dimensions and convert it to
+    /// the unit of the atomic first. Integral value types use the native atomic add; floating point value types
+    /// use atomic<T>::fetch_add where the library provides it and a compare and swap loop otherwise.
+    template <typename Quantity>
+    class atomic_quantity
+    {
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+        using dimension_type = typename quantity_type::dimension_type;
+        using exponents_type = typename quantity_type::exponents_type;
+        static_assert(std::atomic<value_type>::is_always_lock_free, "neounit::atomic_quantity: value type is not lock-free");
+        static constexpr bool is_always_lock_free = true;
+    public:
+        constexpr atomic_quantity() noexcept : iValue{}
+        {
+        }
+        constexpr atomic_quantity(quantity_type const& aValue) noexcept : iValue{ static_cast<value_type>(aValue) }
+        {
+        }
+        atomic_quantity(atomic_quantity const&) = delete;
+        atomic_quantity& operator=(atomic_quantity const&) = delete;
+    public:
+        quantity_type load(std::memory_order aOrder = std::memory_order_seq_cst) const noexcept
+        {
+            return iValue.load(aOrder);
+        }
+        void store(quantity_type const& aValue, std::memory_order aOrder = std::memory_order_seq_cst) noexcept
+        {
+            iValue.store(static_cast<value_type>(aValue), aOrder);
+        }
+        quantity_type exchange(quantity_type const& aValue, std::memory_order aOrder = std::memory_order_seq_cst) noexcept
+        {
+            return iValue.exchange(static_cast<value_type>(aValue), aOrder);
+        }
+        bool compare_exchange_weak(quantity_type& aExpected, quantity_type const& aDesired, std::memory_order aOrder = std::memory_order_seq_cst) noexcept
+        {
+            auto expected = static_cast<value_type>(aExpected);
+            bool const exchanged = iValue.compare_exchange_weak(expected, static_cast<value_type>(aDesired), aOrder);
+            aExpected = expected;
+            return exchanged;
+        }
+        bool compare_exchange_strong(quantity_type& aExpected, quantity_type const& aDesired, std::memory_order aOrder = std::memory_order_seq_cst) noexcept
+        {
+            auto expected = static_cast<value_type>(aExpected);
+            bool const exchanged = iValue.compare_exchange_strong(expected, static_cast<value_type>(aDesired), aOrder);
+            aExpected = expected;
+            return exchanged;
+        }
+        /// Adds aDelta and returns the previous value.
+        template <typename T, std::same_as<exponents_type> Exponents, typename Ratios>
+        quantity_type fetch_add(scalar<T, dimension_type, Exponents, Ratios> const& aDelta, std::memory_order aOrder = std::memory_order_seq_cst) noexcept
+        {
+            return detail::atomic_fetch_add(iValue, static_cast<value_type>(conversion_cast<quantity_type>(aDelta)), aOrder);
+        }
+        /// Subtracts aDelta and returns the previous value.
+        template <typename T, std::same_as<exponents_type> Exponents, typename Ratios>
+        quantity_type fetch_sub(scalar<T, dimension_type, Exponents, Ratios> const& aDelta, std::memory_order aOrder = std::memory_order_seq_cst) noexcept
+        {
+            if constexpr (std::is_integral_v<value_type>)
+                return iValue.fetch_sub(static_cast<value_type>(conversion_cast<quantity_type>(aDelta)), aOrder);
+            else
+                return detail::atomic_fetch_add(iValue, -static_cast<value_type>(conversion_cast<quantity_type>(aDelta)), aOrder);
+        }
+        template <typename T, std::same_as<exponents_type> Exponents, typename Ratios>
+        quantity_type operator+=(scalar<T, dimension_type, Exponents, Ratios> const& aDelta) noexcept
+        {
+            auto const delta = conversion_cast<quantity_type>(aDelta);
+            return fetch_add(delta) + delta;
+        }
+        template <typename T, std::same_as<exponents_type> Exponents, typename Ratios>
+        quantity_type operator-=(scalar<T, dimension_type, Exponents, Ratios> const& aDelta) noexcept
+        {
+            auto const delta = conversion_cast<quantity_type>(aDelta);
+            return fetch_sub(delta) - delta;
+        }
+        operator quantity_type() const noexcept
+        {
+            return load();
+        }
+    private:
+        std::atomic<value_type> iValue;
+    };
+
+    /// An accumulator for quantities added from many threads. Each thread adds to one of a number of shards,
+    /// each on its own cache line, so that threads rarely contend for a line; the shards are only combined when
+    /// the total is read. value() is not a snapshot: additions made while it
+    /// runs may or may not be included.
+    template <typename Quantity>
+    class sharded_accumulator
+    {
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+    private:
+        struct alignas(detail::cache_line_size) shard
+        {
+            atomic_quantity<quantity_type> value;
+        };
+    public:
+        /// The shard count is rounded up to a power of two; by default there is one per hardware thread.
+        explicit sharded_accumulator(std::size_t aShards = std::thread::hardware_concurrency()) :
+            iShardCount{ std::bit_ceil(aShards > 0u ? aShards : 1u) },
+            iShards{ std::make_unique<shard[]>(iShardCount) }
+        {
+        }
+    public:
+        std::size_t shards() const noexcept
+        {
+            return iShardCount;
+        }
+        template <typename T, typename Exponents, typename Ratios>
+        void add(scalar<T, typename quantity_type::dimension_type, Exponents, Ratios> const& aDelta) noexcept
+        {
+            local_shard().value.fetch_add(aDelta, std::memory_order_relaxed);
+        }
+        template <typename T, typename Exponents, typename Ratios>
+        void subtract(scalar<T, typename quantity_type::dimension_type, Exponents, Ratios> const& aDelta) noexcept
+        {
+            local_shard().value.fetch_sub(aDelta, std::memory_order_relaxed);
+        }
+        quantity_type value() const noexcept
+        {
+            quantity_type total{};
+            for (std::size_t i = 0; i < iShardCount; ++i)
+                total = total + iShards[i].value.load(std::memory_order_relaxed);
+            return total;
+        }
+        /// Returns the total and zeroes the shards.
+        quantity_type reset() noexcept
+        {
+            quantity_type total{};
+            for (std::size_t i = 0; i < iShardCount; ++i)
+                total = total + iShards[i].value.exchange(quantity_type{}, std::memory_order_relaxed);
+            return total;
+        }
+    private:
+        shard& local_shard() const noexcept
+        {
+            return iShards[detail::thread_index() & (iShardCount - 1u)];
+        }
+    private:
+        std::size_t iShardCount;
+        std::unique_ptr<shard[]> iShards;
+    };
+}
@@ -0,0 +1,323 @@
+// batch.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <neounit/unit.hpp>
+#include <neounit/descriptor.hpp>
+
+namespace neounit
+{
+    // Conversion of large arrays of quantities on all cores, e.g.
+    //
+    //     batch_converter converter;
+    //     batch_buffer<si::metre> metres{ miles.size() };
+    //     auto const result = converter.convert(std::span{ miles }, metres.span());
+    //
+    // The input is split into chunks sized to stay in cache (input and output together) and each worker is given
+    // a contiguous run of chunks; a worker that finishes its run steals chunks from the others. Each chunk is a
+    // single loop over the chunk with the conversion factor folded (at compile time for static units, once per
+    // batch for unit descriptors) so that it vectorizes. Output in a batch_buffer is first written by the worker
+    // that converts it, which places its pages on that worker's NUMA node; workers are not pinned to cores.
+
+    namespace detail
+    {
+        constexpr std::size_t batch_page_size = 4096u;
+    }
+
+    /// Uninitialized storage for the output of a batch conversion. Elements must be written (by a conversion)
+    /// before they are read.
+    template <typename Quantity>
+    class batch_buffer
+    {
+        static_assert(std::is_trivially_copyable_v<Quantity> && std::is_trivially_destructible_v<Quantity>, "neounit::batch_buffer: unsupported element type");
+    public:
+        using value_type = Quantity;
+    public:
+        explicit batch_buffer(std::size_t aSize) :
+            iData{ static_cast<value_type*>(::operator new(std::max<std::size_t>(aSize, 1u) * sizeof(value_type), std::align_val_t{ detail::batch_page_size })) },
+            iSize{ aSize }
+        {
+        }
+        ~batch_buffer()
+        {
+            ::operator delete(iData, std::align_val_t{ detail::batch_page_size });
+        }
+        batch_buffer(batch_buffer const&) = delete;
+        batch_buffer& operator=(batch_buffer const&) = delete;
+    public:
+        std::size_t size() const
+        {
+            return iSize;
+        }
+        value_type* data()
+        {
+            return iData;
+        }
+        value_type const* data() const
+        {
+            return iData;
+        }
+        std::span<value_type> span()
+        {
+            return { iData, iSize };
+        }
+        std::span<value_type const> span() const
+        {
+            return { iData, iSize };
+        }
+        value_type& operator[](std::size_t aIndex)
+        {
+            return iData[aIndex];
+        }
+        value_type const& operator[](std::size_t aIndex) const
+        {
+            return iData[aIndex];
+        }
+    private:
+        value_type* iData;
+        std::size_t iSize;
+    };
+
+    struct batch_result
+    {
+        std::size_t elements;
+        std::size_t bytes;
+        std::size_t chunks;
+        std::size_t stolenChunks;
+        std::chrono::nanoseconds elapsed;
+
+        double elements_per_second() const
+        {
+            return elapsed.count() > 0 ? static_cast<double>(elements) * 1.0e9 / static_cast<double>(elapsed.count()) : 0.0;
+        }
+        double bytes_per_second() const
+        {
+            return elapsed.count() > 0 ? static_cast<double>(bytes) * 1.0e9 / static_cast<double>(elapsed.count()) : 0.0;
+        }
+    };
+
+    class batch_converter
+    {
+    public:
+        static constexpr std::size_t default_chunk_bytes = 256u * 1024u;
+    public:
+        /// A converter with aThreads workers including the calling thread, which takes part in each conversion.
+        explicit batch_converter(std::size_t aThreads = std::thread::hardware_concurrency(), std::size_t aChunkBytes = default_chunk_bytes) :
+            iThreads{ std::max<std::size_t>(aThreads, 1u) },
+            iChunkBytes{ std::max<std::size_t>(aChunkBytes, 1u) },
+            iRanges{ std::make_unique<range[]>(iThreads) }
+        {
+            iWorkers.reserve(iThreads - 1u);
+            for (std::size_t worker = 1u; worker < iThreads; ++worker)
+                iWorkers.emplace_back([this, worker]() { serve(worker); });
+        }
+        ~batch_converter()
+        {
+            {
+                std::lock_guard lock{ iMutex };
+                iStopping = true;
+            }
+            iStart.notify_all();
+            for (auto& worker : iWorkers)
+                worker.join();
+        }
+        batch_converter(batch_converter const&) = delete;
+        batch_converter& operator=(batch_converter const&) = delete;
+    public:
+        std::size_t threads() const
+        {
+            return iThreads;
+        }
+        /// Elements converted so far by the conversion in progress (or the last one); can be polled from
+        /// another thread.
+        std::size_t progress() const
+        {
+            return iProgress.load(std::memory_order_relaxed);
+        }
+        /// Converts aInput into aOutput (which must be at least as large) with the conversion factor between
+        /// the two static units folded at compile time.
+        template <typename From, std::size_t InputExtent, typename To, std::size_t OutputExtent>
+        batch_result convert(std::span<From, InputExtent> aInput, std::span<To, OutputExtent> aOutput)
+        {
+            if (aOutput.size() < aInput.size())
+                throw std::invalid_argument("neounit::batch_converter: output too small");
+#ifdef NEOUNIT_INSTRUMENT_CONVERSIONS
+            detail::record_conversion<std::remove_const_t<From>, std::remove_const_t<To>>(aInput.size());
+#endif
+            auto const input = aInput.data();
+            auto const output = aOutput.data();
+            return run(aInput.size(), sizeof(From) + sizeof(To), [input, output](std::size_t aBegin, std::size_t aEnd)
+            {
+                for (std::size_t i = aBegin; i < aEnd; ++i)
+                    output[i] = detail::convert_scalar<std::remove_const_t<To>>(input[i]);
+            });
+        }
+        /// Converts raw values in unit aFrom into raw values in unit aTo; throws std::invalid_argument if the
+        /// units have different dimensions.
+        template <typename T, std::size_t InputExtent, std::size_t OutputExtent>
+            requires std::is_floating_point_v<T>
+        batch_result convert(std::span<T const, InputExtent> aInput, unit_descriptor const& aFrom, std::span<T, OutputExtent> aOutput, unit_descriptor const& aTo)
+        {
+            if (aOutput.size() < aInput.size())
+                throw std::invalid_argument("neounit::batch_converter: output too small");
+            auto const factor = conversion_factor<T>(aFrom, aTo);
+            auto const input = aInput.data();
+            auto const output = aOutput.data();
+            return run(aInput.size(), 2u * sizeof(T), [input, output, factor](std::size_t aBegin, std::size_t aEnd)
+            {
+                for (std::size_t i = aBegin; i < aEnd; ++i)
+                    output[i] = input[i] * factor;
+            });
+        }
+    private:
+        struct alignas(128) range
+        {
+            std::atomic<std::size_t> next;
+            std::size_t end;
+        };
+    private:
+        template <typename Kernel>
+        batch_result run(std::size_t aElements, std::size_t aBytesPerElement, Kernel aKernel)
+        {
+            std::lock_guard job{ iJobMutex };
+            auto const start = std::chrono::steady_clock::now();
+            // whole cache lines of output per chunk so that workers do not share lines at chunk boundaries
+            iChunkElements = std::max<std::size_t>(iChunkBytes / aBytesPerElement, 1u);
+            iChunkElements = (iChunkElements + 15u) / 16u * 16u;
+            iElements = aElements;
+            auto const chunks = (aElements + iChunkElements - 1u) / iChunkElements;
+            for (std::size_t worker = 0u; worker < iThreads; ++worker)
+            {
+                iRanges[worker].next.store(chunks * worker / iThreads, std::memory_order_relaxed);
+                iRanges[worker].end = chunks * (worker + 1u) / iThreads;
+            }
+            iProgress.store(0u, std::memory_order_relaxed);
+            iStolen.store(0u, std::memory_order_relaxed);
+            iKernel = aKernel;
+            {
+                std::lock_guard lock{ iMutex };
+                iActive = iThreads - 1u;
+                ++iGeneration;
+            }
+            iStart.notify_all();
+            work(0u);
+            {
+                std::unique_lock lock{ iMutex };
+                iDone.wait(lock, [this]() { return iActive == 0u; });
+            }
+            iKernel = nullptr;
+            return { aElements, aElements * aBytesPerElement, chunks, iStolen.load(std::memory_order_relaxed),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start) };
+        }
+        void serve(std::size_t aWorker)
+        {
+            std::size_t generation = 0u;
+            for (;;)
+            {
+                {
+                    std::unique_lock lock{ iMutex };
+                    iStart.wait(lock, [&]() { return iStopping || iGeneration != generation; });
+                    if (iStopping)
+                        return;
+                    generation = iGeneration;
+                }
+                work(aWorker);
+                bool last = false;
+                {
+                    std::lock_guard lock{ iMutex };
+                    last = (--iActive == 0u);
+                }
+                if (last)
+                    iDone.notify_one();
+            }
+        }
+        void work(std::size_t aWorker)
+        {
+            auto convert_chunks = [&](range& aRange)
+            {
+                std::size_t converted = 0u;
+                for (auto chunk = aRange.next.fetch_add(1u, std::memory_order_relaxed); chunk < aRange.end; chunk = aRange.next.fetch_add(1u, std::memory_order_relaxed))
+                {
+                    auto const begin = chunk * iChunkElements;
+                    auto const end = std::min(begin + iChunkElements, iElements);
+                    iKernel(begin, end);
+                    iProgress.fetch_add(end - begin, std::memory_order_relaxed);
+                    ++converted;
+                }
+                return converted;
+            };
+            convert_chunks(iRanges[aWorker]);
+            for (std::size_t other = 1u; other < iThreads; ++other)
+            {
+                auto const stolen = convert_chunks(iRanges[(aWorker + other) % iThreads]);
+                if (stolen != 0u)
+                    iStolen.fetch_add(stolen, std::memory_order_relaxed);
+            }
+        }
+    private:
+        std::size_t const iThreads;
+        std::size_t const iChunkBytes;
+        std::unique_ptr<range[]> iRanges;
+        std::vector<std::thread> iWorkers;
+        std::mutex iJobMutex;
+        std::mutex iMutex;
+        std::condition_variable iStart;
+        std::condition_variable iDone;
+        std::size_t iGeneration = 0u;
+        std::size_t iActive = 0u;
+        bool iStopping = false;
+        std::function<void(std::size_t, std::size_t)> iKernel;
+        std::size_t iChunkElements = 0u;
+        std::size_t iElements = 0u;
+        std::atomic<std::size_t> iProgress = 0u;
+        std::atomic<std::size_t> iStolen = 0u;
+    };
+}
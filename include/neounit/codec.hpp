@@ -0,0 +1,427 @@
+// codec.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+#include <neounit/descriptor.hpp>
+
+namespace neounit
+{
+    // Compressed encoding of quantity time series, e.g.
+    //
+    //     std::vector<std::byte> stream;
+    //     series_encoder<si::mV> encoder{ stream, si::uV{ 1.0 } }; // quantized to 1 uV
+    //     encoder.append(std::span{ samples });
+    //     encoder.flush();
+    //     series_decoder<si::mV> decoder{ stream };
+    //     decoder.read(std::span{ decoded });
+    //
+    // A stream starts with a header holding the descriptor of its unit and is only decoded as that unit. Values
+    // are written in independent blocks: integral values as zigzag varints of their second differences (delta of
+    // delta); floating point values Gorilla style, as the XOR with the previous value trimmed to its significant
+    // bytes (byte rather than bit aligned so that decoding does not branch per bit); and floating point values
+    // quantized to a resolution as the delta of delta encoding of the number of resolution steps.
+
+    enum class series_method : std::uint8_t
+    {
+        DeltaOfDelta    = 0,
+        Xor             = 1,
+        Quantized       = 2
+    };
+
+    namespace detail
+    {
+        constexpr std::byte series_magic[] = { std::byte{ 'N' }, std::byte{ 'U' } };
+        constexpr std::uint8_t series_version = 1u;
+
+        template <typename T>
+        using series_bits_t = std::conditional_t<sizeof(T) == 8u, std::uint64_t, std::uint32_t>;
+
+        class delta_of_delta_encoder
+        {
+        public:
+            void append(std::vector<std::byte>& aOutput, std::uint64_t aValue)
+            {
+                auto const delta = aValue - iPrevious;
+                write_varint(aOutput, zigzag_encode(static_cast<std::int64_t>(delta - iDelta)));
+                iPrevious = aValue;
+                iDelta = delta;
+            }
+        private:
+            std::uint64_t iPrevious = 0u;
+            std::uint64_t iDelta = 0u;
+        };
+
+        template <typename Bits>
+        class xor_encoder
+        {
+        public:
+            void append(std::vector<std::byte>& aOutput, Bits aValue)
+            {
+                auto const difference = aValue ^ iPrevious;
+                iPrevious = aValue;
+                if (difference == 0u)
+                {
+                    aOutput.push_back(std::byte{ 0u });
+                    return;
+                }
+                auto const trailing = static_cast<unsigned>(std::countr_zero(difference)) / 8u;
+                auto const leading = static_cast<unsigned>(std::countl_zero(difference)) / 8u;
+                auto const length = static_cast<unsigned>(sizeof(Bits)) - trailing - leading;
+                aOutput.push_back(static_cast<std::byte>((trailing << 4) | length));
+                auto const significant = static_cast<std::uint64_t>(difference) >> (trailing * 8u);
+                for (unsigned i = 0u; i < length; ++i)
+                    aOutput.push_back(static_cast<std::byte>(significant >> (i * 8u)));
+            }
+        private:
+            Bits iPrevious = 0u;
+        };
+    }
+
+    template <typename Quantity>
+    class series_encoder
+    {
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+        using dimension_type = typename quantity_type::dimension_type;
+        using exponents_type = typename quantity_type::exponents_type;
+        static_assert(std::is_integral_v<value_type> || (std::is_floating_point_v<value_type> && (sizeof(value_type) == 4u || sizeof(value_type) == 8u)),
+            "neounit::series_encoder: unsupported value type");
+        static constexpr std::size_t block_size = 4096u;
+    public:
+        /// Lossless encoding, delta of delta for integral value types and XOR for floating point value types.
+        explicit series_encoder(std::vector<std::byte>& aOutput) :
+            iOutput{ aOutput }, iMethod{ std::is_integral_v<value_type> ? series_method::DeltaOfDelta : series_method::Xor }, iResolution{}
+        {
+            write_header();
+        }
+        /// Encoding of floating point values rounded to the nearest multiple of aResolution, which can be given in
+        /// any unit with the same dimensions.
+        template <typename T, std::same_as<exponents_type> Exponents, typename Ratios>
+            requires std::is_floating_point_v<value_type>
+        series_encoder(std::vector<std::byte>& aOutput, scalar<T, dimension_type, Exponents, Ratios> const& aResolution) :
+            iOutput{ aOutput }, iMethod{ series_method::Quantized }, iResolution{ static_cast<value_type>(conversion_cast<quantity_type>(aResolution)) }
+        {
+            if (!(iResolution > static_cast<value_type>(0.0)))
+                throw std::invalid_argument("neounit::series_encoder: resolution must be positive");
+            write_header();
+        }
+        /// Writes any pending values; an error doing so is swallowed, so call flush() first to observe it.
+        ~series_encoder()
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+        }
+        series_encoder(series_encoder const&) = delete;
+        series_encoder& operator=(series_encoder const&) = delete;
+    public:
+        series_method method() const
+        {
+            return iMethod;
+        }
+        /// Throws std::domain_error, leaving the encoder unchanged, if the encoding is quantized and the value is not
+        /// finite or its number of resolution steps is not representable as a 64-bit integer.
+        void append(quantity_type const& aValue)
+        {
+            if constexpr (std::is_floating_point_v<value_type>)
+                if (iMethod == series_method::Quantized && !(std::fabs(static_cast<value_type>(aValue) / iResolution) < static_cast<value_type>(0x1p63)))
+                    throw std::domain_error("neounit::series_encoder: value not representable at the resolution");
+            iPending.push_back(static_cast<value_type>(aValue));
+            if (iPending.size() == block_size)
+                flush();
+        }
+        template <std::size_t Extent>
+        void append(std::span<quantity_type const, Extent> aValues)
+        {
+            for (auto const& value : aValues)
+                append(value);
+        }
+        template <std::size_t Extent>
+        void append(std::span<quantity_type, Extent> aValues)
+        {
+            append(std::span<quantity_type const, Extent>{ aValues });
+        }
+        /// Writes the values appended so far as a block.
+        void flush()
+        {
+            if (iPending.empty())
+                return;
+            detail::write_varint(iOutput, iPending.size());
+            if constexpr (std::is_integral_v<value_type>)
+            {
+                detail::delta_of_delta_encoder encoder;
+                for (auto const value : iPending)
+                    encoder.append(iOutput, static_cast<std::uint64_t>(static_cast<std::int64_t>(value)));
+            }
+            else if (iMethod == series_method::Quantized)
+            {
+                detail::delta_of_delta_encoder encoder;
+                for (auto const value : iPending)
+                    encoder.append(iOutput, static_cast<std::uint64_t>(std::llround(value / iResolution)));
+            }
+            else
+            {
+                detail::xor_encoder<detail::series_bits_t<value_type>> encoder;
+                for (auto const value : iPending)
+                    encoder.append(iOutput, std::bit_cast<detail::series_bits_t<value_type>>(value));
+            }
+            iPending.clear();
+        }
+    private:
+        void write_header()
+        {
+            iOutput.insert(iOutput.end(), std::begin(detail::series_magic), std::end(detail::series_magic));
+            iOutput.push_back(std::byte{ detail::series_version });
+            iOutput.push_back(static_cast<std::byte>(iMethod));
+            iOutput.push_back(std::byte{ value_kind_of<value_type>() });
+            write_descriptor(iOutput, descriptor_of<quantity_type>());
+            if (iMethod == series_method::Quantized)
+            {
+                auto const resolution = std::bit_cast<std::uint64_t>(static_cast<double>(iResolution));
+                for (unsigned i = 0u; i < 8u; ++i)
+                    iOutput.push_back(static_cast<std::byte>(resolution >> (i * 8u)));
+            }
+            iPending.reserve(block_size);
+        }
+    private:
+        std::vector<std::byte>& iOutput;
+        series_method iMethod;
+        value_type iResolution;
+        std::vector<value_type> iPending;
+    };
+
+    /// Decodes a stream written by series_encoder<Quantity>; the constructor throws std::invalid_argument if the
+    /// stream is not a series of Quantity (a different unit or value type).
+    template <typename Quantity>
+    class series_decoder
+    {
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+    public:
+        explicit series_decoder(std::span<std::byte const> aInput) :
+            iInput{ aInput }, iPosition{ 0u }, iUnit{}, iMethod{}, iResolution{}, iRemaining{ 0u }, iPrevious{ 0u }, iDelta{ 0u }
+        {
+            if (iInput.size() < 5u || iInput[0] != detail::series_magic[0] || iInput[1] != detail::series_magic[1])
+                throw std::invalid_argument("neounit::series_decoder: not a series");
+            if (iInput[2] != std::byte{ detail::series_version })
+                throw std::invalid_argument("neounit::series_decoder: unsupported version");
+            iMethod = static_cast<series_method>(iInput[3]);
+            if (iMethod != series_method::DeltaOfDelta && iMethod != series_method::Xor && iMethod != series_method::Quantized)
+                throw std::invalid_argument("neounit::series_decoder: unknown method");
+            if (iInput[4] != std::byte{ value_kind_of<value_type>() })
+                throw std::invalid_argument("neounit::series_decoder: value type mismatch");
+            iPosition = 5u;
+            iUnit = read_descriptor(iInput, iPosition);
+            if (iUnit != descriptor_of<quantity_type>())
+                throw std::invalid_argument("neounit::series_decoder: unit mismatch");
+            if (iMethod == series_method::Quantized)
+            {
+                if (iInput.size() - iPosition < 8u)
+                    throw std::invalid_argument("neounit::series_decoder: truncated input");
+                std::uint64_t resolution = 0u;
+                for (unsigned i = 0u; i < 8u; ++i)
+                    resolution |= static_cast<std::uint64_t>(iInput[iPosition++]) << (i * 8u);
+                iResolution = static_cast<value_type>(std::bit_cast<double>(resolution));
+            }
+        }
+    public:
+        unit_descriptor const& unit() const
+        {
+            return iUnit;
+        }
+        series_method method() const
+        {
+            return iMethod;
+        }
+        bool at_end() const
+        {
+            return iRemaining == 0u && iPosition == iInput.size();
+        }
+        /// Decodes up to aOutput.size() values into aOutput and returns the number decoded.
+        template <std::size_t Extent>
+        std::size_t read(std::span<quantity_type, Extent> aOutput)
+        {
+            auto const output = aOutput.data();
+            std::size_t count = 0u;
+            while (count < aOutput.size())
+            {
+                if (iRemaining == 0u)
+                {
+                    if (iPosition == iInput.size())
+                        break;
+                    iRemaining = detail::read_varint(iInput, iPosition);
+                    if (iRemaining == 0u)
+                        throw std::invalid_argument("neounit::series_decoder: empty block");
+                    iPrevious = 0u;
+                    iDelta = 0u;
+                }
+                auto const n = std::min<std::size_t>(iRemaining, aOutput.size() - count);
+                if constexpr (std::is_integral_v<value_type>)
+                    read_delta_of_delta(n, [&](std::size_t aIndex, std::uint64_t aValue) { output[aIndex] = static_cast<value_type>(aValue); }, count);
+                else if (iMethod == series_method::Quantized)
+                    read_delta_of_delta(n, [&](std::size_t aIndex, std::uint64_t aValue) { output[aIndex] = static_cast<value_type>(static_cast<std::int64_t>(aValue)) * iResolution; }, count);
+                else
+                    read_xor(n, output + count);
+                count += n;
+                iRemaining -= n;
+            }
+            return count;
+        }
+    private:
+        template <typename Store>
+        void read_delta_of_delta(std::size_t aCount, Store aStore, std::size_t aOffset)
+        {
+            auto const input = iInput.data();
+            auto const size = iInput.size();
+            auto position = iPosition;
+            auto previous = iPrevious;
+            auto delta = iDelta;
+            for (std::size_t i = 0u; i < aCount; ++i)
+            {
+                std::uint64_t encoded;
+                if (position < size && static_cast<std::uint8_t>(input[position]) < 0x80u)
+                    encoded = static_cast<std::uint8_t>(input[position++]);
+                else
+                    encoded = detail::read_varint(iInput, position);
+                delta += static_cast<std::uint64_t>(detail::zigzag_decode(encoded));
+                previous += delta;
+                aStore(aOffset + i, previous);
+            }
+            iPosition = position;
+            iPrevious = previous;
+            iDelta = delta;
+        }
+        void read_xor(std::size_t aCount, quantity_type* aOutput)
+        {
+            using bits_type = detail::series_bits_t<value_type>;
+            auto const input = iInput.data();
+            auto const size = iInput.size();
+            auto position = iPosition;
+            auto previous = static_cast<bits_type>(iPrevious);
+            for (std::size_t i = 0u; i < aCount; ++i)
+            {
+                if (position >= size)
+                    throw std::invalid_argument("neounit::series_decoder: truncated input");
+                auto const control = static_cast<unsigned>(input[position++]);
+                auto const length = control & 0x0Fu;
+                auto const trailing = control >> 4;
+                if (length + trailing > sizeof(bits_type))
+                    throw std::invalid_argument("neounit::series_decoder: malformed block");
+                std::uint64_t significant = 0u;
+                if (std::endian::native == std::endian::little && size - position >= 8u)
+                {
+                    std::memcpy(&significant, input + position, 8u);
+                    significant &= (length == 8u ? ~std::uint64_t{} : (std::uint64_t{ 1u } << (length * 8u)) - 1u);
+                }
+                else if (size - position >= length)
+                {
+                    for (unsigned j = 0u; j < length; ++j)
+                        significant |= static_cast<std::uint64_t>(input[position + j]) << (j * 8u);
+                }
+                else
+                    throw std::invalid_argument("neounit::series_decoder: truncated input");
+                position += length;
+                previous ^= static_cast<bits_type>(significant << (trailing * 8u));
+                aOutput[i] = std::bit_cast<value_type>(previous);
+            }
+            iPosition = position;
+            iPrevious = previous;
+        }
+    private:
+        std::span<std::byte const> iInput;
+        std::size_t iPosition;
+        unit_descriptor iUnit;
+        series_method iMethod;
+        value_type iResolution;
+        std::uint64_t iRemaining;
+        std::uint64_t iPrevious;
+        std::uint64_t iDelta;
+    };
+
+    template <typename Quantity, std::size_t Extent>
+    inline std::vector<std::byte> encode_series(std::span<Quantity const, Extent> aValues)
+    {
+        std::vector<std::byte> result;
+        series_encoder<Quantity> encoder{ result };
+        encoder.append(aValues);
+        encoder.flush();
+        return result;
+    }
+
+    template <typename Quantity, std::size_t Extent, typename Resolution>
+    inline std::vector<std::byte> encode_series(std::span<Quantity const, Extent> aValues, Resolution const& aResolution)
+    {
+        std::vector<std::byte> result;
+        series_encoder<Quantity> encoder{ result, aResolution };
+        encoder.append(aValues);
+        encoder.flush();
+        return result;
+    }
+
+    template <typename Quantity>
+    inline std::vector<Quantity> decode_series(std::span<std::byte const> aInput)
+    {
+        series_decoder<Quantity> decoder{ aInput };
+        std::vector<Quantity> result;
+        std::size_t count = 0u;
+        do
+        {
+            result.resize(std::max(count * 2u, count + series_encoder<Quantity>::block_size));
+            count += decoder.read(std::span{ result }.subspan(count));
+        } while (!decoder.at_end());
+        result.resize(count);
+        return result;
+    }
+}
@@ -0,0 +1,119 @@
+// constants.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <numbers>
+
+#include <neounit/unit.hpp>
+#include <neounit/si.hpp>
+#include <neounit/si_derived.hpp>
+
+namespace neounit::si
+{
+    // s m g A K mol cd rad B
+
+    #define Js_EXPONENTS -1, 2, 1, 0, 0, 0, 0, 0, 0
+    #define JperK_EXPONENTS -2, 2, 1, 0, -1, 0, 0, 0, 0
+    #define permol_EXPONENTS 0, 0, 0, 0, 0, -1, 0, 0, 0
+    #define lmperW_EXPONENTS 3, -2, -1, 0, 0, 0, 1, 0, 0
+    #define G_EXPONENTS -2, 3, -1, 0, 0, 0, 0, 0, 0
+    #define mps_EXPONENTS -1, 1, 0, 0, 0, 0, 0, 0, 0
+
+    // The electronvolt is exactly e joules; as a canonical (single magnitude) unit conversions to and from it are
+    // exact ratios. Magnitudes are relative to the base units, i.e. the gram rather than the kilogram.
+
+    template<typename T = double> using eV = scalar<T, dimension, exponents<J_EXPONENTS>, magnitude<ratio<1602176634, 1, -25>>>;
+    template<typename T = double> using keV = scalar<T, dimension, exponents<J_EXPONENTS>, magnitude<ratio<1602176634, 1, -22>>>;
+    template<typename T = double> using MeV = scalar<T, dimension, exponents<J_EXPONENTS>, magnitude<ratio<1602176634, 1, -19>>>;
+    template<typename T = double> using GeV = scalar<T, dimension, exponents<J_EXPONENTS>, magnitude<ratio<1602176634, 1, -16>>>;
+
+    using electronvolt = eV<>;
+    using kiloelectronvolt = keV<>;
+    using megaelectronvolt = MeV<>;
+    using gigaelectronvolt = GeV<>;
+}
+
+namespace neounit::si::constants
+{
+    // Physical constants as constexpr quantities. The constants exactly defined by the 2019 SI are units whose
+    // magnitude is the exact value and whose value is one, so products with them multiply exact ratios at compile
+    // time and a result such as m * c * c converts to MeV by a single folded factor. Measured constants (CODATA
+    // 2018) are values of the coherent SI unit in canonical form, as their many significant digits would overflow
+    // the ratio arithmetic in products.
+
+    template<typename T = double> using hyperfine_transition_frequency_t = scalar<T, dimension, exponents<Hz_EXPONENTS>, magnitude<ratio<9192631770>>>;
+    template<typename T = double> using speed_of_light_t = scalar<T, dimension, exponents<mps_EXPONENTS>, magnitude<ratio<299792458>>>;
+    template<typename T = double> using planck_constant_t = scalar<T, dimension, exponents<Js_EXPONENTS>, magnitude<ratio<662607015, 1, -39>>>;
+    template<typename T = double> using elementary_charge_t = scalar<T, dimension, exponents<C_EXPONENTS>, magnitude<ratio<1602176634, 1, -28>>>;
+    template<typename T = double> using boltzmann_constant_t = scalar<T, dimension, exponents<JperK_EXPONENTS>, magnitude<ratio<1380649, 1, -26>>>;
+    template<typename T = double> using avogadro_constant_t = scalar<T, dimension, exponents<permol_EXPONENTS>, magnitude<ratio<602214076, 1, 15>>>;
+    template<typename T = double> using luminous_efficacy_t = scalar<T, dimension, exponents<lmperW_EXPONENTS>, magnitude<ratio<683, 1, -3>>>;
+    template<typename T = double> using reduced_planck_constant_t = scalar<T, dimension, exponents<Js_EXPONENTS>, magnitude<kilo>>;
+    template<typename T = double> using gravitational_constant_t = scalar<T, dimension, exponents<G_EXPONENTS>, magnitude<milli>>;
+    template<typename T = double> using mass_t = scalar<T, dimension, exponents<g_EXPONENTS(1)>, magnitude<kilo>>;
+
+    constexpr hyperfine_transition_frequency_t<> hyperfine_transition_frequency{ 1.0 };
+    constexpr speed_of_light_t<> speed_of_light{ 1.0 };
+    constexpr planck_constant_t<> planck_constant{ 1.0 };
+    constexpr elementary_charge_t<> elementary_charge{ 1.0 };
+    constexpr boltzmann_constant_t<> boltzmann_constant{ 1.0 };
+    constexpr avogadro_constant_t<> avogadro_constant{ 1.0 };
+    constexpr luminous_efficacy_t<> luminous_efficacy{ 1.0 };
+    constexpr auto molar_gas_constant = avogadro_constant * boltzmann_constant;
+    constexpr auto faraday_constant = avogadro_constant * elementary_charge;
+
+    constexpr reduced_planck_constant_t<> reduced_planck_constant{ 6.62607015e-34 / (2.0 * std::numbers::pi) };
+    constexpr gravitational_constant_t<> gravitational_constant{ 6.67430e-11 };
+    constexpr mass_t<> electron_mass{ 9.1093837015e-31 };
+    constexpr mass_t<> proton_mass{ 1.67262192369e-27 };
+
+    /// Conventional symbols; these clash with unit names in neounit::si (e.g. si::h, the hour) so are kept apart.
+    namespace symbols
+    {
+        constexpr auto const& c = speed_of_light;
+        constexpr auto const& h = planck_constant;
+        constexpr auto const& hbar = reduced_planck_constant;
+        constexpr auto const& e = elementary_charge;
+        constexpr auto const& k_B = boltzmann_constant;
+        constexpr auto const& N_A = avogadro_constant;
+        constexpr auto const& R = molar_gas_constant;
+        constexpr auto const& F = faraday_constant;
+        constexpr auto const& G = gravitational_constant;
+        constexpr auto const& m_e = electron_mass;
+        constexpr auto const& m_p = proton_mass;
+    }
+}
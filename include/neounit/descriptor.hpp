@@ -0,0 +1,253 @@
+// descriptor.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <numbers>
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    /// Runtime description of a unit: its dimensional exponents and its magnitude relative to the base units,
+    /// num / den * 10^exp * 2^exp2 * pi^exp_pi (the ratio of canonical_t). Equal units have equal descriptors however their
+    /// types were formed.
+    struct unit_descriptor
+    {
+        static constexpr std::size_t max_dimensions = 9u;
+
+        std::array<std::int8_t, max_dimensions> exponents;
+        std::int64_t num;
+        std::int64_t den;
+        std::int16_t exp;
+        std::int16_t exp2;
+        std::int16_t exp_pi;
+
+        constexpr bool same_dimensions(unit_descriptor const& aOther) const
+        {
+            return exponents == aOther.exponents;
+        }
+
+        friend constexpr bool operator==(unit_descriptor const& aLhs, unit_descriptor const& aRhs) = default;
+    };
+
+    /// One byte description of a value type for binary formats: 0x80 if floating point, 0x40 if signed, and
+    /// the size in bytes.
+    template <typename T>
+    constexpr std::uint8_t value_kind_of()
+    {
+        return static_cast<std::uint8_t>((std::is_floating_point_v<T> ? 0x80u : 0u) | (std::is_signed_v<T> ? 0x40u : 0u) | sizeof(T));
+    }
+
+    namespace detail
+    {
+        template <dimensional_exponent... Exponents>
+        constexpr std::array<std::int8_t, unit_descriptor::max_dimensions> descriptor_exponents(exponents<Exponents...>)
+        {
+            static_assert(sizeof...(Exponents) <= unit_descriptor::max_dimensions, "neounit::unit_descriptor: too many dimensions");
+            static_assert(((Exponents >= -128 && Exponents <= 127) && ...), "neounit::unit_descriptor: exponent out of range");
+            return { static_cast<std::int8_t>(Exponents)... };
+        }
+
+        template <typename T>
+        constexpr T power_10(std::intmax_t aPower)
+        {
+            T result = static_cast<T>(1.0);
+            for (auto e = aPower >= 0 ? aPower : -aPower; e > 0; --e)
+                result *= static_cast<T>(10);
+            return aPower >= 0 ? result : static_cast<T>(1.0) / result;
+        }
+
+        template <typename T>
+        constexpr T power_2(std::intmax_t aPower)
+        {
+            T result = static_cast<T>(1.0);
+            for (auto e = aPower >= 0 ? aPower : -aPower; e > 0; --e)
+                result *= static_cast<T>(2);
+            return aPower >= 0 ? result : static_cast<T>(1.0) / result;
+        }
+
+        template <typename T>
+        constexpr T power_pi(std::intmax_t aPower)
+        {
+            T result = static_cast<T>(1.0);
+            for (auto e = aPower >= 0 ? aPower : -aPower; e > 0; --e)
+                result *= std::numbers::pi_v<T>;
+            return aPower >= 0 ? result : static_cast<T>(1.0) / result;
+        }
+
+        constexpr std::uint64_t zigzag_encode(std::int64_t aValue)
+        {
+            return (static_cast<std::uint64_t>(aValue) << 1) ^ static_cast<std::uint64_t>(aValue >> 63);
+        }
+
+        constexpr std::int64_t zigzag_decode(std::uint64_t aValue)
+        {
+            return static_cast<std::int64_t>((aValue >> 1) ^ (0u - (aValue & 1u)));
+        }
+
+        inline void write_varint(std::vector<std::byte>& aOutput, std::uint64_t aValue)
+        {
+            while (aValue >= 0x80u)
+            {
+                aOutput.push_back(static_cast<std::byte>(aValue | 0x80u));
+                aValue >>= 7;
+            }
+            aOutput.push_back(static_cast<std::byte>(aValue));
+        }
+
+        inline std::uint64_t read_varint(std::span<std::byte const> aInput, std::size_t& aPosition)
+        {
+            std::uint64_t result = 0u;
+            for (unsigned shift = 0u; shift < 64u; shift += 7u)
+            {
+                if (aPosition >= aInput.size())
+                    throw std::invalid_argument("neounit: truncated input");
+                auto const byte = static_cast<std::uint64_t>(aInput[aPosition++]);
+                result |= (byte & 0x7Fu) << shift;
+                if (byte < 0x80u)
+                    return result;
+            }
+            throw std::invalid_argument("neounit: malformed varint");
+        }
+    }
+
+    template <typename Unit>
+    constexpr unit_descriptor descriptor_of()
+    {
+        using exponents_type = typename Unit::exponents_type;
+        using magnitude_type = detail::magnitude_of_t<exponents_type, typename Unit::ratios_type>;
+        static_assert(magnitude_type::exp >= -32768 && magnitude_type::exp <= 32767 && magnitude_type::exp2 >= -32768 && magnitude_type::exp2 <= 32767 &&
+            magnitude_type::exp_pi >= -32768 && magnitude_type::exp_pi <= 32767);
+        return { detail::descriptor_exponents(exponents_type{}), magnitude_type::num, magnitude_type::den,
+            static_cast<std::int16_t>(magnitude_type::exp), static_cast<std::int16_t>(magnitude_type::exp2),
+            static_cast<std::int16_t>(magnitude_type::exp_pi) };
+    }
+
+    template <typename Unit>
+    constexpr unit_descriptor descriptor_of(Unit const&)
+    {
+        return descriptor_of<Unit>();
+    }
+
+    /// The factor by which a value in aFrom is multiplied to give the same quantity in aTo; the runtime
+    /// counterpart of the coefficient used by conversion_cast.
+    template <typename T = double>
+    constexpr T conversion_factor(unit_descriptor const& aFrom, unit_descriptor const& aTo)
+    {
+        if (!aFrom.same_dimensions(aTo))
+            throw std::invalid_argument("neounit::conversion_factor: incompatible dimensions");
+        if (aFrom == aTo)
+            return static_cast<T>(1.0);
+        return static_cast<T>(static_cast<long double>(aFrom.num) * aTo.den / (static_cast<long double>(aFrom.den) * aTo.num) *
+            detail::power_10<long double>(aFrom.exp - aTo.exp) * detail::power_2<long double>(aFrom.exp2 - aTo.exp2) *
+            detail::power_pi<long double>(aFrom.exp_pi - aTo.exp_pi));
+    }
+
+    /// The reduced integer multiplier and divisor by which a value in aFrom is scaled to give the same quantity in
+    /// aTo; the runtime counterpart of the scale used by conversion_cast between integral values. Throws
+    /// std::invalid_argument if the units differ by a power of pi (which has no integer scale) and
+    /// std::overflow_error if a term does not fit.
+    inline detail::integral_scale integral_conversion_scale(unit_descriptor const& aFrom, unit_descriptor const& aTo)
+    {
+        if (!aFrom.same_dimensions(aTo))
+            throw std::invalid_argument("neounit::integral_conversion_scale: incompatible dimensions");
+        if (aFrom.exp_pi != aTo.exp_pi)
+            throw std::invalid_argument("neounit::integral_conversion_scale: no integer scale");
+        constexpr std::int64_t maximum = std::numeric_limits<std::int64_t>::max();
+        auto const g1 = std::gcd(aFrom.num, aTo.num);
+        auto const g2 = std::gcd(aFrom.den, aTo.den);
+        std::int64_t multiplier = aFrom.num / g1;
+        std::int64_t divisor = aFrom.den / g2;
+        auto const multiply = [&](std::int64_t& aTerm, std::int64_t aFactor)
+        {
+            if (aTerm > maximum / aFactor)
+                throw std::overflow_error("neounit: integral conversion factor overflow");
+            aTerm *= aFactor;
+        };
+        multiply(multiplier, aTo.den / g2);
+        multiply(divisor, aTo.num / g1);
+        for (auto e = aFrom.exp - aTo.exp; e != 0; e += (e > 0 ? -1 : 1))
+            multiply(e > 0 ? multiplier : divisor, 10);
+        for (auto e = aFrom.exp2 - aTo.exp2; e != 0; e += (e > 0 ? -1 : 1))
+            multiply(e > 0 ? multiplier : divisor, 2);
+        auto const g = std::gcd(multiplier, divisor);
+        return { multiplier / g, divisor / g };
+    }
+
+    // Compact binary form of a descriptor: one byte per exponent then the magnitude as zigzag varints (a base
+    // unit takes 14 bytes).
+
+    inline void write_descriptor(std::vector<std::byte>& aOutput, unit_descriptor const& aDescriptor)
+    {
+        for (auto const e : aDescriptor.exponents)
+            aOutput.push_back(static_cast<std::byte>(e));
+        detail::write_varint(aOutput, detail::zigzag_encode(aDescriptor.num));
+        detail::write_varint(aOutput, detail::zigzag_encode(aDescriptor.den));
+        detail::write_varint(aOutput, detail::zigzag_encode(aDescriptor.exp));
+        detail::write_varint(aOutput, detail::zigzag_encode(aDescriptor.exp2));
+        detail::write_varint(aOutput, detail::zigzag_encode(aDescriptor.exp_pi));
+    }
+
+    /// Reads a descriptor written by write_descriptor starting at aPosition, which is advanced past it.
+    inline unit_descriptor read_descriptor(std::span<std::byte const> aInput, std::size_t& aPosition)
+    {
+        unit_descriptor result{};
+        if (aPosition > aInput.size() || aInput.size() - aPosition < result.exponents.size())
+            throw std::invalid_argument("neounit::read_descriptor: truncated input");
+        for (auto& e : result.exponents)
+            e = static_cast<std::int8_t>(aInput[aPosition++]);
+        result.num = detail::zigzag_decode(detail::read_varint(aInput, aPosition));
+        result.den = detail::zigzag_decode(detail::read_varint(aInput, aPosition));
+        auto const exp = detail::zigzag_decode(detail::read_varint(aInput, aPosition));
+        auto const exp2 = detail::zigzag_decode(detail::read_varint(aInput, aPosition));
+        auto const expPi = detail::zigzag_decode(detail::read_varint(aInput, aPosition));
+        if (result.num == 0 || result.den <= 0 || exp < -32768 || exp > 32767 || exp2 < -32768 || exp2 > 32767 || expPi < -32768 || expPi > 32767)
+            throw std::invalid_argument("neounit::read_descriptor: malformed descriptor");
+        result.exp = static_cast<std::int16_t>(exp);
+        result.exp2 = static_cast<std::int16_t>(exp2);
+        result.exp_pi = static_cast<std::int16_t>(expPi);
+        return result;
+    }
+}
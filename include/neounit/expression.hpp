@@ -0,0 +1,245 @@
+// expression.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+#include <neounit/math.hpp>
+
+namespace neounit
+{
+    // Lazy products and quotients: neounit::lazy(q) wraps a quantity so that * and / with other quantities and
+    // numbers build an expression of raw values and summed exponents instead of intermediate scalars. The unit
+    // multiples of every operand are folded into a single compile time coefficient applied once when the expression
+    // is converted to a scalar, e.g.
+    //
+    //     metre_per_second v = lazy(1.0_km) / 1.0_h;            // 1.0 / 1.0 * (1000 / 3600)
+    //     auto d = conversion_cast<si::metre>(lazy(v) * 2.0_h); // no conversion_cast needed on the operands
+    //
+    // Mixed unit products that combine_t cannot express as a single unit need no intermediate casts.
+
+    template <typename Derived>
+    class lazy_quantity;
+
+    template <typename T>
+    constexpr bool is_lazy_quantity_v = std::is_base_of_v<lazy_quantity<std::remove_cv_t<T>>, std::remove_cv_t<T>>;
+
+    namespace detail
+    {
+        // Multiple of the coherent (base ratio) unit with the same exponents as the given unit.
+        template <typename Exponents, typename Ratios>
+        struct base_scale
+        {
+            static constexpr long double value = ratio_value<long double, magnitude_of_t<Exponents, Ratios>>();
+        };
+
+        template <typename Lhs, typename Rhs, bool Quotient>
+        struct combine_exponents;
+        template <dimensional_exponent... LhsExponents, dimensional_exponent... RhsExponents, bool Quotient>
+        struct combine_exponents<exponents<LhsExponents...>, exponents<RhsExponents...>, Quotient>
+        {
+            using result_type = exponents<(Quotient ? LhsExponents - RhsExponents : LhsExponents + RhsExponents)...>;
+        };
+
+        template <typename Exponents>
+        struct zero_exponents;
+        template <dimensional_exponent... Exponents>
+        struct zero_exponents<exponents<Exponents...>>
+        {
+            using result_type = exponents<(Exponents * 0)...>;
+            using ratios_type = ratios<std::conditional_t<(Exponents == Exponents), none, none>...>;
+        };
+    }
+
+    template <typename Derived>
+    class lazy_quantity
+    {
+    public:
+        /// The value of the expression in the unit To (or as a number if To is the value type and the expression
+        /// is dimensionless): the raw arithmetic followed by at most one multiplication.
+        template <typename To>
+        constexpr To evaluate() const
+        {
+            using derived_type = Derived;
+            using value_type = typename derived_type::value_type;
+            if constexpr (is_scalar_quantity_v<To>)
+            {
+                static_assert(std::is_same_v<typename To::dimension_type, typename derived_type::dimension_type> &&
+                    std::is_same_v<typename To::exponents_type, typename derived_type::exponents_type>, "neounit::lazy_quantity: incompatible dimensions");
+                constexpr long double factor = derived_type::scale / detail::base_scale<typename To::exponents_type, typename To::ratios_type>::value;
+                if constexpr (factor == 1.0L)
+                    return static_cast<typename To::value_type>(as_derived().value());
+                else
+                    return static_cast<typename To::value_type>(as_derived().value() * static_cast<value_type>(factor));
+            }
+            else
+            {
+                static_assert(std::is_same_v<typename derived_type::exponents_type, typename detail::zero_exponents<typename derived_type::exponents_type>::result_type>,
+                    "neounit::lazy_quantity: expression is not dimensionless");
+                constexpr long double factor = derived_type::scale;
+                if constexpr (factor == 1.0L)
+                    return static_cast<To>(as_derived().value());
+                else
+                    return static_cast<To>(as_derived().value() * static_cast<value_type>(factor));
+            }
+        }
+        template <typename T, typename Dimension, typename Exponents, typename Ratios>
+        constexpr operator scalar<T, Dimension, Exponents, Ratios>() const
+        {
+            return evaluate<scalar<T, Dimension, Exponents, Ratios>>();
+        }
+    private:
+        constexpr Derived const& as_derived() const
+        {
+            return static_cast<Derived const&>(*this);
+        }
+    };
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    class lazy_scalar : public lazy_quantity<lazy_scalar<T, Dimension, Exponents, Ratios>>
+    {
+    public:
+        using value_type = T;
+        using dimension_type = Dimension;
+        using exponents_type = Exponents;
+        static constexpr long double scale = detail::base_scale<Exponents, Ratios>::value;
+    public:
+        constexpr lazy_scalar(value_type aValue) : iValue{ aValue }
+        {
+        }
+    public:
+        constexpr value_type value() const
+        {
+            return iValue;
+        }
+    private:
+        value_type iValue;
+    };
+
+    template <typename Lhs, typename Rhs, bool Quotient>
+    class lazy_expression : public lazy_quantity<lazy_expression<Lhs, Rhs, Quotient>>
+    {
+        static_assert(std::is_same_v<typename Lhs::value_type, typename Rhs::value_type> && std::is_same_v<typename Lhs::dimension_type, typename Rhs::dimension_type>);
+    public:
+        using value_type = typename Lhs::value_type;
+        using dimension_type = typename Lhs::dimension_type;
+        using exponents_type = typename detail::combine_exponents<typename Lhs::exponents_type, typename Rhs::exponents_type, Quotient>::result_type;
+        static constexpr long double scale = Quotient ? Lhs::scale / Rhs::scale : Lhs::scale * Rhs::scale;
+    public:
+        constexpr lazy_expression(Lhs const& aLhs, Rhs const& aRhs) : iLhs{ aLhs }, iRhs{ aRhs }
+        {
+        }
+    public:
+        constexpr value_type value() const
+        {
+            if constexpr (Quotient)
+                return iLhs.value() / iRhs.value();
+            else
+                return iLhs.value() * iRhs.value();
+        }
+    private:
+        Lhs iLhs;
+        Rhs iRhs;
+    };
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    constexpr inline lazy_scalar<T, Dimension, Exponents, Ratios> lazy(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return static_cast<T>(aValue);
+    }
+
+    template <typename To, typename Expression>
+    constexpr inline std::enable_if_t<is_lazy_quantity_v<Expression>, To> conversion_cast(Expression const& aExpression)
+    {
+        return aExpression.template evaluate<To>();
+    }
+
+    namespace detail
+    {
+        template <typename Other, typename Operand>
+        constexpr inline auto as_lazy(Operand const& aOperand)
+        {
+            if constexpr (is_lazy_quantity_v<Operand>)
+                return aOperand;
+            else if constexpr (is_scalar_quantity_v<Operand>)
+                return lazy(aOperand);
+            else
+            {
+                using value_type = typename Other::value_type;
+                using zero_type = zero_exponents<typename Other::exponents_type>;
+                using number_type = lazy_scalar<value_type, typename Other::dimension_type, typename zero_type::result_type, typename zero_type::ratios_type>;
+                return number_type{ static_cast<value_type>(aOperand) };
+            }
+        }
+
+        template <typename Lhs, typename Rhs>
+        constexpr bool is_lazy_operation_v = (is_lazy_quantity_v<Lhs> || is_lazy_quantity_v<Rhs>) &&
+            (is_lazy_quantity_v<Lhs> || is_scalar_quantity_v<Lhs> || std::is_arithmetic_v<Lhs>) &&
+            (is_lazy_quantity_v<Rhs> || is_scalar_quantity_v<Rhs> || std::is_arithmetic_v<Rhs>);
+
+        template <bool Quotient, typename Lhs, typename Rhs>
+        constexpr inline auto make_lazy_expression(Lhs const& aLhs, Rhs const& aRhs)
+        {
+            using lhs_other = std::conditional_t<is_lazy_quantity_v<Lhs>, Lhs, Rhs>;
+            using rhs_other = std::conditional_t<is_lazy_quantity_v<Rhs>, Rhs, Lhs>;
+            auto const lhs = as_lazy<lhs_other>(aLhs);
+            auto const rhs = as_lazy<rhs_other>(aRhs);
+            return lazy_expression<std::decay_t<decltype(lhs)>, std::decay_t<decltype(rhs)>, Quotient>{ lhs, rhs };
+        }
+    }
+
+    template <typename Lhs, typename Rhs>
+        requires detail::is_lazy_operation_v<Lhs, Rhs>
+    constexpr inline lazy_expression<
+        decltype(detail::as_lazy<std::conditional_t<is_lazy_quantity_v<Lhs>, Lhs, Rhs>>(std::declval<Lhs>())),
+        decltype(detail::as_lazy<std::conditional_t<is_lazy_quantity_v<Rhs>, Rhs, Lhs>>(std::declval<Rhs>())), false> operator*(
+        Lhs const& aLhs, Rhs const& aRhs)
+    {
+        return detail::make_lazy_expression<false>(aLhs, aRhs);
+    }
+
+    template <typename Lhs, typename Rhs>
+        requires detail::is_lazy_operation_v<Lhs, Rhs>
+    constexpr inline lazy_expression<
+        decltype(detail::as_lazy<std::conditional_t<is_lazy_quantity_v<Lhs>, Lhs, Rhs>>(std::declval<Lhs>())),
+        decltype(detail::as_lazy<std::conditional_t<is_lazy_quantity_v<Rhs>, Rhs, Lhs>>(std::declval<Rhs>())), true> operator/(
+        Lhs const& aLhs, Rhs const& aRhs)
+    {
+        return detail::make_lazy_expression<true>(aLhs, aRhs);
+    }
+}
@@ -0,0 +1,297 @@
+// float16.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+#if defined(__F16C__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    // Reduced precision storage types. A value is stored in 16 bits and widened to float for arithmetic; each
+    // arithmetic result is rounded back to the storage type (round to nearest, ties to even). Conversion from
+    // double goes through float. std::float16_t and std::bfloat16_t can be used in the same way where the
+    // library provides them. For longer computations widen() a quantity, compute in float and narrow() the
+    // result; pack() and unpack() do the same for whole columns and use F16C or AVX-512 conversion instructions
+    // for float16 when compiled for a CPU that has them.
+
+    namespace detail
+    {
+        constexpr std::uint16_t float_to_half_bits(float aValue)
+        {
+            auto const bits = std::bit_cast<std::uint32_t>(aValue);
+            auto const sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+            auto const magnitude = bits & 0x7FFFFFFFu;
+            if (magnitude > 0x7F800000u)
+                return sign | 0x7E00u;
+            if (magnitude >= 0x477FF000u) // rounds to 65536 or more
+                return sign | 0x7C00u;
+            if (magnitude >= 0x38800000u) // normal
+                return sign | static_cast<std::uint16_t>((magnitude + 0xFFFu + ((magnitude >> 13) & 1u) - 0x38000000u) >> 13);
+            if (magnitude < 0x33000000u) // 2^-25 or less rounds to zero
+                return sign;
+            auto const shift = 126u - (magnitude >> 23);
+            auto const mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+            auto const halfway = 1u << (shift - 1u);
+            auto const remainder = mantissa & ((1u << shift) - 1u);
+            auto result = mantissa >> shift;
+            if (remainder > halfway || (remainder == halfway && (result & 1u) != 0u))
+                ++result;
+            return sign | static_cast<std::uint16_t>(result);
+        }
+
+        constexpr float half_bits_to_float(std::uint16_t aBits)
+        {
+            auto const sign = static_cast<std::uint32_t>(aBits & 0x8000u) << 16;
+            auto const exponent = (aBits >> 10) & 0x1Fu;
+            auto const mantissa = static_cast<std::uint32_t>(aBits & 0x3FFu);
+            if (exponent == 0x1Fu)
+                return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+            if (exponent != 0u)
+                return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+            auto const subnormal = static_cast<float>(mantissa) * 0x1p-24f;
+            return sign != 0u ? -subnormal : subnormal;
+        }
+
+        constexpr std::uint16_t float_to_bfloat_bits(float aValue)
+        {
+            auto const bits = std::bit_cast<std::uint32_t>(aValue);
+            if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+                return static_cast<std::uint16_t>((bits >> 16) | 0x40u);
+            return static_cast<std::uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+        }
+
+        constexpr float bfloat_bits_to_float(std::uint16_t aBits)
+        {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(aBits) << 16);
+        }
+
+        template <std::uint16_t (*Narrow)(float), float (*Widen)(std::uint16_t)>
+        class reduced_float
+        {
+        public:
+            constexpr reduced_float() : iBits{}
+            {
+            }
+            explicit constexpr reduced_float(float aValue) : iBits{ Narrow(aValue) }
+            {
+            }
+        public:
+            static constexpr reduced_float from_bits(std::uint16_t aBits)
+            {
+                reduced_float result;
+                result.iBits = aBits;
+                return result;
+            }
+            constexpr std::uint16_t bits() const
+            {
+                return iBits;
+            }
+            constexpr operator float() const
+            {
+                return Widen(iBits);
+            }
+        public:
+            constexpr reduced_float operator+() const
+            {
+                return *this;
+            }
+            constexpr reduced_float operator-() const
+            {
+                return from_bits(iBits ^ 0x8000u);
+            }
+            friend constexpr reduced_float operator+(reduced_float aLhs, reduced_float aRhs)
+            {
+                return reduced_float{ static_cast<float>(aLhs) + static_cast<float>(aRhs) };
+            }
+            friend constexpr reduced_float operator-(reduced_float aLhs, reduced_float aRhs)
+            {
+                return reduced_float{ static_cast<float>(aLhs) - static_cast<float>(aRhs) };
+            }
+            friend constexpr reduced_float operator*(reduced_float aLhs, reduced_float aRhs)
+            {
+                return reduced_float{ static_cast<float>(aLhs) * static_cast<float>(aRhs) };
+            }
+            friend constexpr reduced_float operator/(reduced_float aLhs, reduced_float aRhs)
+            {
+                return reduced_float{ static_cast<float>(aLhs) / static_cast<float>(aRhs) };
+            }
+            constexpr reduced_float& operator+=(reduced_float aRhs)
+            {
+                return *this = *this + aRhs;
+            }
+            constexpr reduced_float& operator-=(reduced_float aRhs)
+            {
+                return *this = *this - aRhs;
+            }
+            constexpr reduced_float& operator*=(reduced_float aRhs)
+            {
+                return *this = *this * aRhs;
+            }
+            constexpr reduced_float& operator/=(reduced_float aRhs)
+            {
+                return *this = *this / aRhs;
+            }
+        private:
+            std::uint16_t iBits;
+        };
+    }
+
+    /// IEEE 754 binary16: 11 significant bits, normal range 6.1e-5 to 65504.
+    using float16 = detail::reduced_float<detail::float_to_half_bits, detail::half_bits_to_float>;
+    /// bfloat16: the upper half of a float, 8 significant bits and the range of float.
+    using bfloat16 = detail::reduced_float<detail::float_to_bfloat_bits, detail::bfloat_bits_to_float>;
+
+    template <>
+    struct compute_type<float16> { using type = float; };
+    template <>
+    struct compute_type<bfloat16> { using type = float; };
+#ifdef __STDCPP_FLOAT16_T__
+    template <>
+    struct compute_type<std::float16_t> { using type = float; };
+#endif
+#ifdef __STDCPP_BFLOAT16_T__
+    template <>
+    struct compute_type<std::bfloat16_t> { using type = float; };
+#endif
+
+    /// The quantity in the compute type of its value type.
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    constexpr inline scalar<compute_type_t<T>, Dimension, Exponents, Ratios> widen(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return static_cast<compute_type_t<T>>(static_cast<T>(aValue));
+    }
+
+    /// The quantity rounded to the storage type Storage.
+    template <typename Storage, typename T, typename Dimension, typename Exponents, typename Ratios>
+    constexpr inline scalar<Storage, Dimension, Exponents, Ratios> narrow(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return static_cast<Storage>(static_cast<T>(aValue));
+    }
+
+    /// Rounds a column of quantities to the storage type of aOutput, which must have the same unit.
+    template <typename Input, std::size_t InputExtent, typename Output, std::size_t OutputExtent>
+    inline void pack(std::span<Input, InputExtent> aInput, std::span<Output, OutputExtent> aOutput)
+    {
+        using T = typename std::remove_const_t<Input>::value_type;
+        using Storage = typename Output::value_type;
+        static_assert(std::is_same_v<typename std::remove_const_t<Input>::unit_type, typename Output::unit_type>, "neounit::pack: units differ");
+        if (aInput.size() != aOutput.size())
+            throw std::invalid_argument("neounit::pack: input and output sizes differ");
+        auto const input = aInput.data();
+        auto const output = aOutput.data();
+        auto const count = aInput.size();
+        std::size_t i = 0;
+#if defined(__AVX512F__) || defined(__F16C__)
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<Storage, float16>)
+        {
+#if defined(__AVX512F__)
+            constexpr std::size_t lanes = 16u;
+#else
+            constexpr std::size_t lanes = 8u;
+#endif
+            for (; i + lanes <= count; i += lanes)
+            {
+                float block[lanes];
+                std::uint16_t bits[lanes];
+                for (std::size_t j = 0; j < lanes; ++j)
+                    block[j] = static_cast<float>(input[i + j]);
+#if defined(__AVX512F__)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(bits), _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(block), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#else
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(bits), _mm256_cvtps_ph(_mm256_loadu_ps(block), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif
+                for (std::size_t j = 0; j < lanes; ++j)
+                    output[i + j] = float16::from_bits(bits[j]);
+            }
+        }
+#endif
+        for (; i < count; ++i)
+            output[i] = static_cast<Storage>(static_cast<T>(input[i]));
+    }
+
+    /// Widens a column of quantities to the value type of aOutput, which must have the same unit.
+    template <typename Input, std::size_t InputExtent, typename Output, std::size_t OutputExtent>
+    inline void unpack(std::span<Input, InputExtent> aInput, std::span<Output, OutputExtent> aOutput)
+    {
+        using Storage = typename std::remove_const_t<Input>::value_type;
+        using T = typename Output::value_type;
+        static_assert(std::is_same_v<typename std::remove_const_t<Input>::unit_type, typename Output::unit_type>, "neounit::unpack: units differ");
+        if (aInput.size() != aOutput.size())
+            throw std::invalid_argument("neounit::unpack: input and output sizes differ");
+        auto const input = aInput.data();
+        auto const output = aOutput.data();
+        auto const count = aInput.size();
+        std::size_t i = 0;
+#if defined(__AVX512F__) || defined(__F16C__)
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<Storage, float16>)
+        {
+#if defined(__AVX512F__)
+            constexpr std::size_t lanes = 16u;
+#else
+            constexpr std::size_t lanes = 8u;
+#endif
+            for (; i + lanes <= count; i += lanes)
+            {
+                std::uint16_t bits[lanes];
+                float block[lanes];
+                for (std::size_t j = 0; j < lanes; ++j)
+                    bits[j] = static_cast<Storage>(input[i + j]).bits();
+#if defined(__AVX512F__)
+                _mm512_storeu_ps(block, _mm512_maskz_cvtph_ps(0xFFFF, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bits))));
+#else
+                _mm256_storeu_ps(block, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(bits))));
+#endif
+                for (std::size_t j = 0; j < lanes; ++j)
+                    output[i + j] = block[j];
+            }
+        }
+#endif
+        for (; i < count; ++i)
+            output[i] = static_cast<T>(static_cast<Storage>(input[i]));
+    }
+}
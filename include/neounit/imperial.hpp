@@ -45,44 +45,71 @@ namespace neounit::imperial
     using si::dimension;
 
     template<dimensional_exponent E, typename T = double>
-    using in = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<254, 10000>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using in = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<254, 10000>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using ft = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<254 * 12, 10000>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using ft = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<254 * 12, 10000>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using yd = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<254 * 12 * 3, 10000>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using yd = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<254 * 12 * 3, 10000>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using mi = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<1609344, 1000>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using mi = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, ratio<1609344, 1000>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using gr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<6479891, 1, -8>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using gr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<6479891, 1, -8>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>                          
-    using dr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<17718451953125, 1, -13>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using dr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<17718451953125, 1, -13>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>                          
-    using oz = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<28349523125, 1, -9>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using oz = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<28349523125, 1, -9>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>                          
-    using lb = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<45359237, 1, -5>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using lb = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<45359237, 1, -5>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>                          
-    using st = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<635029318, 1, -5>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using st = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<635029318, 1, -5>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>                          
-    using qr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<1270058636, 1, -5>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using qr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<1270058636, 1, -5>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using cwt = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<5080234544, 1, -5>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using cwt = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<5080234544, 1, -5>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using t_ = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<10160469088, 1, -4>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using t_ = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, ratio<10160469088, 1, -4>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
 
     namespace literals
     {
-        inline auto operator "" _in(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254, 10000>, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _ft(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12, 10000>, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _yd(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12 * 3, 10000>, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _mi(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<1609344, 1000>, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _gr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<6479891, 1, -8>, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _dr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<17718451953125, 1, -13>, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _oz(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<28349523125, 1, -9>, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _lb(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<45359237, 1, -5>, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _st(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<635029318, 1, -5>, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _qr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<1270058636, 1, -5>, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _cwt(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<5080234544, 1, -5>, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _t_(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<10160469088, 1, -4>, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _in(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254, 10000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _in(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254, 10000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _ft(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12, 10000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _ft(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12, 10000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _yd(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12 * 3, 10000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _yd(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12 * 3, 10000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _mi(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<1609344, 1000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _mi(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<1609344, 1000>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _gr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<6479891, 1, -8>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _gr(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<6479891, 1, -8>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<17718451953125, 1, -13>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dr(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<17718451953125, 1, -13>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _oz(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<28349523125, 1, -9>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _oz(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<28349523125, 1, -9>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _lb(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<45359237, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _lb(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<45359237, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _st(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<635029318, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _st(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<635029318, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _qr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<1270058636, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _qr(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<1270058636, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _cwt(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<5080234544, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _cwt(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<5080234544, 1, -5>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _t_(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<10160469088, 1, -4>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _t_(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<10160469088, 1, -4>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        namespace exact
+        {
+            template <char... Chars> consteval auto operator "" _in() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254, 10000>, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _ft() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12, 10000>, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _yd() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<254 * 12 * 3, 10000>, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _mi() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio<1609344, 1000>, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _gr() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<6479891, 1, -8>, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _dr() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<17718451953125, 1, -13>, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _oz() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<28349523125, 1, -9>, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _lb() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<45359237, 1, -5>, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _st() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<635029318, 1, -5>, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _qr() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<1270058636, 1, -5>, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _cwt() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<5080234544, 1, -5>, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _t_() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio<10160469088, 1, -4>, none, none, none, none, none, none>>, Chars...>(); }
+        }
     }
 
     using in_sq = in<2>;
@@ -172,103 +199,130 @@ namespace neounit::imperial
 
     #define define_imperial_prefix(ShortPrefix, Ratio)\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## in = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## in = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## ft = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## ft = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## yd = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## yd = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## mi = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## mi = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## gr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## gr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## dr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## dr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## oz = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## oz = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## lb = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## lb = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## st = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## st = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## qr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## qr = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## cwt = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## cwt = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## t_ = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
-    using ShortPrefix ## in_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none>>;\
-    using ShortPrefix ## ft_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none>>;\
-    using ShortPrefix ## yd_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none>>;\
-    using ShortPrefix ## mi_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none>>;\
-    using ShortPrefix ## gr_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## dr_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## oz_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## lb_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## st_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## qr_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## cwt_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## t__sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none>>;\
-    using inv_ ## ShortPrefix ## in = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## ft = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## yd = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## mi = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<21609344, 1000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## gr = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## dr = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## oz = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## lb = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## st = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## qr = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## cwt = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## t_ = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## in_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## ft_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## yd_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## mi_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## gr_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## dr_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## oz_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## lb_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## st_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## qr_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## cwt_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## t__sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using Ratio ## inch = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none>>;\
-    using Ratio ## foot = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none>>;\
-    using Ratio ## yard = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none>>;\
-    using Ratio ## mile = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none>>;\
-    using Ratio ## grain = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none>>;\
-    using Ratio ## drachm = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none>>;\
-    using Ratio ## ounce = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none>>;\
-    using Ratio ## pound = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none>>;\
-    using Ratio ## stone = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none>>;\
-    using Ratio ## quarter = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none>>;\
-    using Ratio ## hundredweight = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none>>;\
-    using Ratio ## ton = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none>>;\
-    using inv_ ## Ratio ## inch = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## foot = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## yard = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## mile = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## grain = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## drachm = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## ounce = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## pound = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## stone = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## quarter = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## hundredweight = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## ton = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using ShortPrefix ## t_ = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## in_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## ft_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## yd_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## mi_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## gr_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## dr_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## oz_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## lb_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## st_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## qr_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## cwt_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## t__sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>>;\
+    using inv_ ## ShortPrefix ## in = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## ft = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## yd = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## mi = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<21609344, 1000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## gr = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## dr = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## oz = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## lb = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## st = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## qr = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## cwt = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## t_ = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## in_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## ft_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## yd_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## mi_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## gr_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## dr_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## oz_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## lb_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## st_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## qr_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## cwt_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## t__sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using Ratio ## inch = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using Ratio ## foot = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using Ratio ## yard = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using Ratio ## mile = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>>;\
+    using Ratio ## grain = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## drachm = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## ounce = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## pound = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## stone = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## quarter = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## hundredweight = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## ton = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>>;\
+    using inv_ ## Ratio ## inch = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## foot = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## yard = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## mile = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## grain = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## drachm = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## ounce = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## pound = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## stone = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## quarter = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## hundredweight = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## ton = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
     namespace literals\
     {\
-        inline auto operator "" _ ## ShortPrefix ## in(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## ft(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## yd(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## mi(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## gr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## dr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## oz(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## lb(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## st(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## qr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## cwt(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## t_(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## in(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## in(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## ft(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## ft(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## yd(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## yd(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## mi(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## mi(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## gr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## gr(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## dr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## dr(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## oz(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## oz(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## lb(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## lb(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## st(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## st(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## qr(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## qr(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## cwt(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## cwt(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## t_(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## t_(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        namespace exact\
+        {\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## in() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254, 10000>, Ratio>, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## ft() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12, 10000>, Ratio>, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## yd() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<254 * 12 * 3, 10000>, Ratio>, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## mi() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, ratio_multiply<ratio<1609344, 1000>, Ratio>, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## gr() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<6479891, 1, -8>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## dr() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<17718451953125, 1, -13>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## oz() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<28349523125, 1, -9>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## lb() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<45359237, 1, -5>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## st() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<635029318, 1, -5>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## qr() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<1270058636, 1, -5>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## cwt() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<5080234544, 1, -5>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## t_() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, ratio_multiply<ratio<10160469088, 1, -4>, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+        }\
     }
 
     define_imperial_prefix(q, quecto)
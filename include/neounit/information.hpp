@@ -0,0 +1,110 @@
+// information.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <neounit/unit.hpp>
+#include <neounit/si.hpp>
+
+namespace neounit::si
+{
+    // s m g A K mol cd rad B
+
+    // The base unit of information is the byte; a bit is an eighth of one. SI prefixes (kB, MB...) are decimal
+    // multiples and IEC prefixes (KiB, MiB...) binary multiples; conversions between integer quantities in
+    // units a power of two apart are shifts.
+    using bit_ratio = ratio<1, 8>;
+
+    template<typename T = double> using B = scalar<T, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, one>>;
+    template<typename T = double> using b = scalar<T, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, bit_ratio>>;
+
+    using byte = B<>;
+    using bit = b<>;
+
+    namespace literals
+    {
+        constexpr inline auto operator "" _B(long double n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, one>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _B(unsigned long long n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, one>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _b(long double n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, bit_ratio>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _b(unsigned long long n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, bit_ratio>>{ static_cast<double>(n) }; }
+        namespace exact
+        {
+            template <char... Chars> consteval auto operator "" _B() { return make_exact_literal<scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, one>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _b() { return make_exact_literal<scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, bit_ratio>>, Chars...>(); }
+        }
+    }
+
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::Information, E, bit_ratio> { static inline auto const value = std::string{ "bit" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::Information, E, bit_ratio> { static inline auto const value = std::u8string{ u8"bit" }; };
+
+    #define define_information_prefix(ShortPrefix, Ratio)\
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::Information, E, ratio_multiply<bit_ratio, Ratio>> { static inline auto const value = std::string{ ratio_short_prefix<Ratio>::prefix } + "bit"; };\
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::Information, E, ratio_multiply<bit_ratio, Ratio>> { static inline auto const value = std::u8string{ ratio_short_u8prefix<Ratio>::prefix } + u8"bit"; };\
+    template<typename T = double> using ShortPrefix ## B = scalar<T, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, Ratio>>;\
+    template<typename T = double> using ShortPrefix ## b = scalar<T, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, ratio_multiply<bit_ratio, Ratio>>>;\
+    using Ratio ## byte = ShortPrefix ## B<>;\
+    using Ratio ## bit = ShortPrefix ## b<>;\
+    namespace literals\
+    {\
+        constexpr inline auto operator "" _ ## ShortPrefix ## B(long double n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, Ratio>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## B(unsigned long long n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, Ratio>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## b(long double n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, ratio_multiply<bit_ratio, Ratio>>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## b(unsigned long long n) { return scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, ratio_multiply<bit_ratio, Ratio>>>{ static_cast<double>(n) }; }\
+        namespace exact\
+        {\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## B() { return make_exact_literal<scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, Ratio>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## b() { return make_exact_literal<scalar<double, dimension, exponents<B_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, none, ratio_multiply<bit_ratio, Ratio>>>, Chars...>(); }\
+        }\
+    }
+
+    define_information_prefix(k, kilo)
+    define_information_prefix(M, mega)
+    define_information_prefix(G, giga)
+    define_information_prefix(T, tera)
+    define_information_prefix(P, peta)
+    define_information_prefix(E, exa)
+    define_information_prefix(Z, zetta)
+    define_information_prefix(Y, yotta)
+    define_information_prefix(Ki, kibi)
+    define_information_prefix(Mi, mebi)
+    define_information_prefix(Gi, gibi)
+    define_information_prefix(Ti, tebi)
+    define_information_prefix(Pi, pebi)
+    define_information_prefix(Ei, exbi)
+    define_information_prefix(Zi, zebi)
+    define_information_prefix(Yi, yobi)
+}
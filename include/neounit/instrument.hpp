@@ -0,0 +1,178 @@
+// instrument.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace neounit
+{
+    // Counts of runtime conversions per (From, To) unit pair, for finding the conversions worth removing
+    // upstream. Defining NEOUNIT_INSTRUMENT_CONVERSIONS before including neounit makes conversion_cast and
+    // batch_converter count calls and elements converted; without it nothing is counted and conversion_cast is
+    // unchanged.
+    //
+    // Counts are kept per thread in plain thread_local counters (so that counting a conversion in a loop costs
+    // next to nothing) and are merged into the totals when the thread calls publish_conversion_counts;
+    // conversion_counts publishes for the calling thread and returns a snapshot of the totals. Threads that
+    // convert should publish from time to time and before they exit; counts a thread has not published are not
+    // in the snapshot. A batch conversion is one call, counted on the thread that started it.
+
+    struct conversion_count
+    {
+        std::string from;
+        std::string to;
+        std::uint64_t calls;
+        std::uint64_t elements;
+    };
+
+    namespace detail
+    {
+        struct conversion_tally
+        {
+            std::uint64_t calls;
+            std::uint64_t elements;
+        };
+
+        struct conversion_pair
+        {
+            std::string (*from)();
+            std::string (*to)();
+            conversion_tally& (*local)();
+            conversion_tally total;
+        };
+
+        struct conversion_registry
+        {
+            std::mutex mutex;
+            std::vector<conversion_pair> pairs;
+
+            static conversion_registry& instance()
+            {
+                static conversion_registry sRegistry;
+                return sRegistry;
+            }
+        };
+
+        template <typename Unit>
+        std::string conversion_unit_name()
+        {
+            if constexpr (requires { base_units_to_string(Unit{}); })
+                return base_units_to_string(Unit{});
+            else
+                return typeid(Unit).name();
+        }
+
+        template <typename From, typename To>
+        struct conversion_counter
+        {
+            // constant initialized and trivially destructible so that it is accessed directly, without a TLS
+            // wrapper, and updates in a loop can be combined
+            static inline thread_local conversion_tally tally = {};
+
+            static conversion_tally& local()
+            {
+                return tally;
+            }
+
+            static inline bool const registered = []()
+            {
+                auto& registry = conversion_registry::instance();
+                std::lock_guard lock{ registry.mutex };
+                registry.pairs.push_back({ &conversion_unit_name<From>, &conversion_unit_name<To>, &local, {} });
+                return true;
+            }();
+        };
+
+        template <typename From, typename To>
+        inline void record_conversion(std::size_t aElements)
+        {
+            static_cast<void>(&conversion_counter<From, To>::registered);
+            auto& tally = conversion_counter<From, To>::tally;
+            ++tally.calls;
+            tally.elements += aElements;
+        }
+    }
+
+    /// Adds the calling thread's counts to the totals and clears them.
+    inline void publish_conversion_counts()
+    {
+        auto& registry = detail::conversion_registry::instance();
+        std::lock_guard lock{ registry.mutex };
+        for (auto& pair : registry.pairs)
+        {
+            auto& tally = pair.local();
+            pair.total.calls += tally.calls;
+            pair.total.elements += tally.elements;
+            tally = {};
+        }
+    }
+
+    /// Snapshot of the totals (including the calling thread's counts), most elements first.
+    inline std::vector<conversion_count> conversion_counts()
+    {
+        publish_conversion_counts();
+        std::vector<detail::conversion_pair> pairs;
+        {
+            auto& registry = detail::conversion_registry::instance();
+            std::lock_guard lock{ registry.mutex };
+            pairs = registry.pairs;
+        }
+        std::vector<conversion_count> result;
+        for (auto const& pair : pairs)
+            if (pair.total.calls != 0u)
+                result.push_back({ pair.from(), pair.to(), pair.total.calls, pair.total.elements });
+        std::stable_sort(result.begin(), result.end(), [](conversion_count const& aLhs, conversion_count const& aRhs) { return aLhs.elements > aRhs.elements; });
+        return result;
+    }
+
+    /// Clears the totals and the calling thread's counts.
+    inline void reset_conversion_counts()
+    {
+        auto& registry = detail::conversion_registry::instance();
+        std::lock_guard lock{ registry.mutex };
+        for (auto& pair : registry.pairs)
+        {
+            pair.local() = {};
+            pair.total = {};
+        }
+    }
+}
@@ -0,0 +1,359 @@
+// logarithmic.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <bit>
+#include <span>
+#include <stdexcept>
+
+#include <neounit/unit.hpp>
+#include <neounit/si.hpp>
+#include <neounit/si_derived.hpp>
+
+namespace neounit
+{
+    struct power_quantity { static constexpr integer factor = 10; };
+    struct root_power_quantity { static constexpr integer factor = 20; };
+
+    struct decibel_scale {};
+    struct neper_scale {};
+
+    namespace detail
+    {
+        template <typename T>
+        inline constexpr T decibels_per_neper = static_cast<T>(8.6858896380650365530225783783321); // 20 / ln(10)
+
+        template <typename To, typename From, typename T>
+        inline constexpr T rescale_log(T aValue)
+        {
+            if constexpr (std::is_same_v<To, From>)
+                return aValue;
+            else if constexpr (std::is_same_v<To, decibel_scale>)
+                return aValue * decibels_per_neper<T>;
+            else
+                return aValue / decibels_per_neper<T>;
+        }
+
+        /// Branch-free log10 for the bulk conversions; loops calling it auto-vectorize as it uses
+        /// no tables and no integer/floating conversion instructions.
+        /// Domain: positive, finite, normal x. Absolute error: |fast_log10(x) - log10(x)| <= 1e-11
+        /// (series truncation bound 2t^13/(13(1-t^2)) / ln(10) with |t| <= 3 - 2*sqrt(2), plus rounding).
+        inline double fast_log10(double x)
+        {
+            constexpr std::uint64_t offset = 0x3FE6A09E667F3BCDull; // sqrt(1/2)
+            constexpr double magic = 0x1.8p52;
+            auto const bits = std::bit_cast<std::uint64_t>(x);
+            auto const shifted = bits - offset;
+            auto const k = static_cast<std::int64_t>(shifted) >> 52;
+            auto const z = std::bit_cast<double>(bits - (shifted & 0xFFF0000000000000ull)); // x = z * 2^k, z in [sqrt(1/2), sqrt(2))
+            auto const kd = std::bit_cast<double>(std::bit_cast<std::uint64_t>(magic) + static_cast<std::uint64_t>(k)) - magic;
+            auto const t = (z - 1.0) / (z + 1.0);
+            auto const t2 = t * t;
+            auto const series = 1.0 + t2 * (1.0 / 3.0 + t2 * (1.0 / 5.0 + t2 * (1.0 / 7.0 + t2 * (1.0 / 9.0 + t2 * (1.0 / 11.0)))));
+            auto const lnz = 2.0 * t * series;
+            return kd * 0.30102999566398119521 + lnz * 0.43429448190325182765;
+        }
+
+        /// Branch-free 10^y for the bulk conversions (see fast_log10).
+        /// Domain: -307 <= y <= 308 (normal results). Relative error: <= 1e-12
+        /// (degree 10 Taylor remainder on |f ln 2| <= ln(2)/2, plus rounding of y log2(10)).
+        inline double fast_exp10(double y)
+        {
+            constexpr double magic = 0x1.8p52;
+            auto const x = y * 3.3219280948873623479;
+            auto const kd = x + magic;
+            auto const n = kd - magic;
+            auto const k = std::bit_cast<std::uint64_t>(kd) - std::bit_cast<std::uint64_t>(magic);
+            auto const g = (x - n) * 0.69314718055994530942;
+            auto const p = 1.0 + g * (1.0 + g * (1.0 / 2.0 + g * (1.0 / 6.0 + g * (1.0 / 24.0 + g * (1.0 / 120.0 + g * (1.0 / 720.0 +
+                g * (1.0 / 5040.0 + g * (1.0 / 40320.0 + g * (1.0 / 362880.0 + g * (1.0 / 3628800.0))))))))));
+            return std::bit_cast<double>(std::bit_cast<std::uint64_t>(p) + (k << 52));
+        }
+    }
+
+    template <typename Scale, typename T = double>
+    class log_ratio
+    {
+    public:
+        using self_type = log_ratio<Scale, T>;
+        using scale_type = Scale;
+        using value_type = T;
+    public:
+        constexpr log_ratio() : iValue{}
+        {
+        }
+        constexpr log_ratio(value_type aValue) : iValue{ aValue }
+        {
+        }
+    public:
+        explicit constexpr operator value_type() const
+        {
+            return iValue;
+        }
+        constexpr self_type operator+() const
+        {
+            return +iValue;
+        }
+        constexpr self_type operator-() const
+        {
+            return -iValue;
+        }
+    public:
+        friend constexpr self_type operator+(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue + aRhs.iValue;
+        }
+        friend constexpr self_type operator-(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue - aRhs.iValue;
+        }
+        friend constexpr self_type operator*(self_type const& aLhs, value_type const& aRhs)
+        {
+            return aLhs.iValue * aRhs;
+        }
+        friend constexpr self_type operator*(value_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs * aRhs.iValue;
+        }
+        friend constexpr self_type operator/(self_type const& aLhs, value_type const& aRhs)
+        {
+            return aLhs.iValue / aRhs;
+        }
+        friend constexpr bool operator==(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue == aRhs.iValue;
+        }
+        friend constexpr auto operator<=>(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue <=> aRhs.iValue;
+        }
+    private:
+        value_type iValue;
+    };
+
+    template <typename Reference, typename Quantity, typename T = typename Reference::value_type>
+    class level
+    {
+    public:
+        using self_type = level<Reference, Quantity, T>;
+        using reference_type = Reference;
+        using quantity_type = Quantity;
+        using value_type = T;
+        using difference_type = log_ratio<decibel_scale, value_type>;
+    public:
+        constexpr level() : iValue{}
+        {
+        }
+        constexpr level(value_type aValue) : iValue{ aValue }
+        {
+        }
+    public:
+        explicit constexpr operator value_type() const
+        {
+            return iValue;
+        }
+    public:
+        template <typename Scale>
+        friend constexpr self_type operator+(self_type const& aLhs, log_ratio<Scale, value_type> const& aRhs)
+        {
+            return aLhs.iValue + detail::rescale_log<decibel_scale, Scale>(static_cast<value_type>(aRhs));
+        }
+        template <typename Scale>
+        friend constexpr self_type operator+(log_ratio<Scale, value_type> const& aLhs, self_type const& aRhs)
+        {
+            return detail::rescale_log<decibel_scale, Scale>(static_cast<value_type>(aLhs)) + aRhs.iValue;
+        }
+        template <typename Scale>
+        friend constexpr self_type operator-(self_type const& aLhs, log_ratio<Scale, value_type> const& aRhs)
+        {
+            return aLhs.iValue - detail::rescale_log<decibel_scale, Scale>(static_cast<value_type>(aRhs));
+        }
+        friend constexpr difference_type operator-(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue - aRhs.iValue;
+        }
+        // levels cannot be added; convert to linear quantities first
+        friend constexpr self_type operator+(self_type const& aLhs, self_type const& aRhs) = delete;
+        friend constexpr bool operator==(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue == aRhs.iValue;
+        }
+        friend constexpr auto operator<=>(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue <=> aRhs.iValue;
+        }
+    private:
+        value_type iValue;
+    };
+
+    template <typename To, typename Scale, typename T>
+    constexpr inline To conversion_cast(log_ratio<Scale, T> const& aRhs)
+    {
+        return detail::rescale_log<typename To::scale_type, Scale>(static_cast<T>(aRhs));
+    }
+
+    template <typename To, typename Reference, typename Quantity, typename T>
+    inline To conversion_cast(level<Reference, Quantity, T> const& aRhs)
+    {
+        static_assert(std::is_same_v<typename To::quantity_type, Quantity>);
+        if constexpr (std::is_same_v<typename To::reference_type, Reference>)
+            return static_cast<T>(aRhs);
+        auto const offset = Quantity::factor * std::log10(static_cast<T>(conversion_cast<typename To::reference_type>(Reference{ static_cast<typename Reference::value_type>(1.0) })));
+        return static_cast<T>(aRhs) + static_cast<typename To::value_type>(offset);
+    }
+
+    template <typename Level, typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline Level to_level(scalar<T, Dimension, Exponents, Ratios> const& aLinear)
+    {
+        using value_type = typename Level::value_type;
+        auto const linear = static_cast<value_type>(conversion_cast<typename Level::reference_type>(aLinear));
+        return static_cast<value_type>(Level::quantity_type::factor * std::log10(linear));
+    }
+
+    template <typename Reference, typename Quantity, typename T>
+    inline Reference to_linear(level<Reference, Quantity, T> const& aLevel)
+    {
+        using value_type = typename Reference::value_type;
+        return static_cast<value_type>(std::pow(static_cast<value_type>(10.0), static_cast<T>(aLevel) / Quantity::factor));
+    }
+
+    template <typename Quantity, typename Scale, typename T>
+    inline T to_linear(log_ratio<Scale, T> const& aRatio)
+    {
+        return std::pow(static_cast<T>(10.0), detail::rescale_log<decibel_scale, Scale>(static_cast<T>(aRatio)) / Quantity::factor);
+    }
+
+    template <typename LogRatio, typename Quantity, typename T>
+    inline LogRatio to_log_ratio(T aLinear)
+    {
+        using value_type = typename LogRatio::value_type;
+        auto const decibels = static_cast<value_type>(Quantity::factor * std::log10(aLinear));
+        return detail::rescale_log<typename LogRatio::scale_type, decibel_scale>(decibels);
+    }
+
+    /// Bulk linear to level conversion using detail::fast_log10 (absolute error <= 1e-11 * Quantity::factor).
+    /// The unit conversion from Linear to the level's reference unit is folded into a single additive offset.
+    template <typename Linear, typename Reference, typename Quantity, typename T>
+    inline void to_level(std::span<Linear> aInput, std::span<level<Reference, Quantity, T>> aOutput)
+    {
+        using linear_type = std::remove_cv_t<Linear>;
+        using linear_value_type = typename linear_type::value_type;
+        if (aOutput.size() < aInput.size())
+            throw std::invalid_argument("neounit::to_level: output too small");
+        double const factor = Quantity::factor;
+        double const offset = factor * std::log10(static_cast<double>(static_cast<linear_value_type>(
+            conversion_cast<Reference>(linear_type{ static_cast<linear_value_type>(1.0) }))));
+        auto const count = aInput.size();
+        auto const input = aInput.data();
+        auto const output = aOutput.data();
+        for (std::size_t i = 0; i < count; ++i)
+            output[i] = static_cast<T>(factor * detail::fast_log10(static_cast<double>(static_cast<linear_value_type>(input[i]))) + offset);
+    }
+
+    /// Bulk level to linear conversion using detail::fast_exp10 (relative error <= 1e-12).
+    /// The unit conversion from the level's reference unit to Linear is folded into the exponent.
+    template <typename Reference, typename Quantity, typename T, typename Linear>
+    inline void to_linear(std::span<level<Reference, Quantity, T> const> aInput, std::span<Linear> aOutput)
+    {
+        using linear_value_type = typename Linear::value_type;
+        if (aOutput.size() < aInput.size())
+            throw std::invalid_argument("neounit::to_linear: output too small");
+        double const scale = 1.0 / Quantity::factor;
+        double const offset = std::log10(static_cast<double>(static_cast<linear_value_type>(
+            conversion_cast<Linear>(Reference{ static_cast<typename Reference::value_type>(1.0) }))));
+        auto const count = aInput.size();
+        auto const input = aInput.data();
+        auto const output = aOutput.data();
+        for (std::size_t i = 0; i < count; ++i)
+            output[i] = static_cast<linear_value_type>(detail::fast_exp10(static_cast<double>(static_cast<T>(input[i])) * scale + offset));
+    }
+
+    template <typename Reference, typename Quantity, typename T, typename Linear>
+    inline void to_linear(std::span<level<Reference, Quantity, T>> aInput, std::span<Linear> aOutput)
+    {
+        to_linear(std::span<level<Reference, Quantity, T> const>{ aInput }, aOutput);
+    }
+}
+
+namespace neounit::logarithmic
+{
+    using si::dimension;
+
+    template<typename T = double>
+    using dB = log_ratio<decibel_scale, T>;
+    template<typename T = double>
+    using Np = log_ratio<neper_scale, T>;
+    // The prefixed references carry their prefix in the mass slot only (e.g. mW = g m^2 s^-3) so that each
+    // is exactly 10^-3 (10^-6) of its coherent unit; define_si_derived_prefix applies the prefix to every slot.
+    template<typename T = double>
+    using dBW = level<scalar<T, dimension, exponents<W_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>, power_quantity>;
+    template<typename T = double>
+    using dBm = level<scalar<T, dimension, exponents<W_EXPONENTS>, ratios<one, one, one, none, none, none, none, none, none>>, power_quantity>;
+    template<typename T = double>
+    using dBV = level<scalar<T, dimension, exponents<V_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, root_power_quantity>;
+    template<typename T = double>
+    using dBmV = level<scalar<T, dimension, exponents<V_EXPONENTS>, ratios<one, one, one, one, none, none, none, none, none>>, root_power_quantity>;
+    template<typename T = double>
+    using dBuV = level<scalar<T, dimension, exponents<V_EXPONENTS>, ratios<one, one, milli, one, none, none, none, none, none>>, root_power_quantity>;
+
+    using decibel = dB<>;
+    using neper = Np<>;
+    using decibel_watt = dBW<>;
+    using decibel_milliwatt = dBm<>;
+    using decibel_volt = dBV<>;
+    using decibel_millivolt = dBmV<>;
+    using decibel_microvolt = dBuV<>;
+
+    namespace literals
+    {
+        constexpr inline auto operator "" _dB(long double n) { return log_ratio<decibel_scale, double>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dB(unsigned long long n) { return log_ratio<decibel_scale, double>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Np(long double n) { return log_ratio<neper_scale, double>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Np(unsigned long long n) { return log_ratio<neper_scale, double>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBW(long double n) { return dBW<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBW(unsigned long long n) { return dBW<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBm(long double n) { return dBm<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBm(unsigned long long n) { return dBm<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBV(long double n) { return dBV<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBV(unsigned long long n) { return dBV<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBmV(long double n) { return dBmV<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBmV(unsigned long long n) { return dBmV<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBuV(long double n) { return dBuV<>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _dBuV(unsigned long long n) { return dBuV<>{ static_cast<double>(n) }; }
+    }
+}
@@ -0,0 +1,287 @@
+// lut.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <vector>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    // Interpolation tables with unit-typed axes and values, e.g. lut<si::kelvin, si::ohm>. Inputs may be given in
+    // any unit of the axis dimension (e.g. millikelvin); the conversion factor is a compile time constant that is
+    // folded into the index arithmetic. Inputs outside the table are clamped to its ends. The batch operators are
+    // branch free loops over raw storage which the compiler can vectorize using gathers.
+
+    enum class interpolation
+    {
+        linear,
+        cubic
+    };
+
+    namespace detail
+    {
+        constexpr std::size_t lut_block = 64u;
+
+        template <typename T>
+        constexpr inline T lerp(T aY0, T aY1, T aFraction)
+        {
+            return aY0 + (aY1 - aY0) * aFraction;
+        }
+
+        // cubic Hermite segment; tangents are per segment (i.e. already multiplied by the segment width)
+        template <typename T>
+        constexpr inline T hermite(T aY0, T aY1, T aM0, T aM1, T aFraction)
+        {
+            T const f2 = aFraction * aFraction;
+            T const f3 = f2 * aFraction;
+            return (2 * f3 - 3 * f2 + 1) * aY0 + (f3 - 2 * f2 + aFraction) * aM0 + (-2 * f3 + 3 * f2) * aY1 + (f3 - f2) * aM1;
+        }
+
+        template <typename To, typename From>
+        constexpr inline typename To::value_type axis_value(From const& aInput)
+        {
+            static_assert(std::is_same_v<typename To::exponents_type, typename From::exponents_type>, "neounit::lut: incompatible dimensions");
+            return static_cast<typename To::value_type>(conversion_cast<To>(aInput));
+        }
+
+        template <typename Y>
+        inline std::vector<typename Y::value_type> raw_values(std::span<Y const> aValues)
+        {
+            if (aValues.size() < 2u)
+                throw std::invalid_argument("neounit::lut: at least two values required");
+            std::vector<typename Y::value_type> result;
+            result.reserve(aValues.size());
+            for (auto const& value : aValues)
+                result.push_back(static_cast<typename Y::value_type>(value));
+            return result;
+        }
+    }
+
+    /// Table over evenly spaced inputs from aFirst to aLast; lookup is O(1).
+    template <typename X, typename Y, interpolation Interpolation = interpolation::linear>
+    class uniform_lut
+    {
+    public:
+        using input_type = X;
+        using output_type = Y;
+        using input_value_type = typename X::value_type;
+        using value_type = typename Y::value_type;
+    public:
+        uniform_lut(input_type const& aFirst, input_type const& aLast, std::span<output_type const> aValues) :
+            iFirst{ static_cast<input_value_type>(aFirst) },
+            iValues{ detail::raw_values(aValues) },
+            iScale{ static_cast<input_value_type>(iValues.size() - 1u) / (static_cast<input_value_type>(aLast) - iFirst) },
+            iLastIndex{ static_cast<input_value_type>(iValues.size() - 1u) }
+        {
+            if (!(aFirst < aLast) || iValues.size() > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+                throw std::invalid_argument("neounit::uniform_lut: invalid range");
+            if constexpr (Interpolation == interpolation::cubic)
+            {
+                auto const n = iValues.size();
+                iTangents.resize(n);
+                iTangents.front() = iValues[1] - iValues[0];
+                iTangents.back() = iValues[n - 1] - iValues[n - 2];
+                for (std::size_t i = 1; i + 1 < n; ++i)
+                    iTangents[i] = (iValues[i + 1] - iValues[i - 1]) / 2;
+            }
+        }
+    public:
+        template <typename Input>
+        constexpr output_type operator()(Input const& aInput) const
+        {
+            return interpolate(detail::axis_value<input_type>(aInput));
+        }
+        template <typename Input>
+        void operator()(std::span<Input const> aInputs, std::span<output_type> aOutputs) const
+        {
+            if (aOutputs.size() < aInputs.size())
+                throw std::invalid_argument("neounit::uniform_lut: target too small");
+            // results are built in a local block so that the compiler can see that the gathers from the table are
+            // not aliased by the outputs
+            auto const table = state();
+            auto const inputs = aInputs.data();
+            auto const outputs = aOutputs.data();
+            for (std::size_t start = 0; start < aInputs.size(); start += detail::lut_block)
+            {
+                auto const count = std::min(detail::lut_block, aInputs.size() - start);
+                value_type block[detail::lut_block];
+                for (std::size_t i = 0; i < count; ++i)
+                    block[i] = interpolate(table, detail::axis_value<input_type>(inputs[start + i]));
+                for (std::size_t i = 0; i < count; ++i)
+                    outputs[start + i] = block[i];
+            }
+        }
+    private:
+        struct table_state
+        {
+            input_value_type first;
+            input_value_type scale;
+            input_value_type lastIndex;
+            std::int32_t lastSegment;
+            value_type const* values;
+            value_type const* tangents;
+        };
+        constexpr table_state state() const
+        {
+            return { iFirst, iScale, iLastIndex, static_cast<std::int32_t>(iValues.size() - 2u), iValues.data(), iTangents.data() };
+        }
+        constexpr value_type interpolate(input_value_type aInput) const
+        {
+            return interpolate(state(), aInput);
+        }
+        static constexpr value_type interpolate(table_state const& aTable, input_value_type aInput)
+        {
+            // max/min rather than std::clamp so that a NaN input maps to the first segment
+            auto const position = std::min(std::max((aInput - aTable.first) * aTable.scale, input_value_type{}), aTable.lastIndex);
+            auto const index = std::min(static_cast<std::int32_t>(position), aTable.lastSegment);
+            auto const fraction = static_cast<value_type>(position - static_cast<input_value_type>(index));
+            if constexpr (Interpolation == interpolation::linear)
+                return detail::lerp(aTable.values[index], aTable.values[index + 1], fraction);
+            else
+                return detail::hermite(aTable.values[index], aTable.values[index + 1], aTable.tangents[index], aTable.tangents[index + 1], fraction);
+        }
+    private:
+        input_value_type iFirst;
+        std::vector<value_type> iValues;
+        std::vector<value_type> iTangents;
+        input_value_type iScale;
+        input_value_type iLastIndex;
+    };
+
+    /// Table over strictly increasing, arbitrarily spaced inputs; the breakpoints are searched in Eytzinger
+    /// (breadth first) order, which is branch free and cache friendly for large tables.
+    template <typename X, typename Y, interpolation Interpolation = interpolation::linear>
+    class lut
+    {
+    public:
+        using input_type = X;
+        using output_type = Y;
+        using input_value_type = typename X::value_type;
+        using value_type = typename Y::value_type;
+    public:
+        lut(std::span<input_type const> aBreakpoints, std::span<output_type const> aValues) :
+            iBreakpoints{ detail::raw_values(aBreakpoints) },
+            iValues{ detail::raw_values(aValues) }
+        {
+            auto const n = iBreakpoints.size();
+            if (n != iValues.size())
+                throw std::invalid_argument("neounit::lut: breakpoint and value counts differ");
+            for (std::size_t i = 1; i < n; ++i)
+                if (!(iBreakpoints[i - 1] < iBreakpoints[i]))
+                    throw std::invalid_argument("neounit::lut: breakpoints not strictly increasing");
+            iSearch.resize(n + 1u);
+            iRank.resize(n + 1u);
+            std::size_t next = 0;
+            build(1u, next);
+            if constexpr (Interpolation == interpolation::cubic)
+            {
+                auto slope = [&](std::size_t aLower, std::size_t aUpper)
+                {
+                    return (iValues[aUpper] - iValues[aLower]) / static_cast<value_type>(iBreakpoints[aUpper] - iBreakpoints[aLower]);
+                };
+                iSlopes.resize(n);
+                iSlopes.front() = slope(0u, 1u);
+                iSlopes.back() = slope(n - 2u, n - 1u);
+                for (std::size_t i = 1; i + 1 < n; ++i)
+                    iSlopes[i] = slope(i - 1u, i + 1u);
+            }
+        }
+    public:
+        template <typename Input>
+        output_type operator()(Input const& aInput) const
+        {
+            return interpolate(detail::axis_value<input_type>(aInput));
+        }
+        template <typename Input>
+        void operator()(std::span<Input const> aInputs, std::span<output_type> aOutputs) const
+        {
+            if (aOutputs.size() < aInputs.size())
+                throw std::invalid_argument("neounit::lut: target too small");
+            auto const inputs = aInputs.data();
+            auto const outputs = aOutputs.data();
+            for (std::size_t i = 0; i < aInputs.size(); ++i)
+                outputs[i] = interpolate(detail::axis_value<input_type>(inputs[i]));
+        }
+    private:
+        void build(std::size_t aNode, std::size_t& aNext)
+        {
+            if (aNode >= iSearch.size())
+                return;
+            build(2u * aNode, aNext);
+            iSearch[aNode] = iBreakpoints[aNext];
+            iRank[aNode] = static_cast<std::uint32_t>(aNext++);
+            build(2u * aNode + 1u, aNext);
+        }
+        // index of the segment containing aInput
+        std::size_t segment(input_value_type aInput) const
+        {
+            std::size_t const n = iBreakpoints.size();
+            std::size_t node = 1u;
+            while (node <= n)
+                node = 2u * node + static_cast<std::size_t>(iSearch[node] <= aInput);
+            node >>= std::countr_one(node) + 1;
+            std::size_t const upper = node == 0u ? n : iRank[node];
+            return std::clamp<std::size_t>(upper, 1u, n - 1u) - 1u;
+        }
+        value_type interpolate(input_value_type aInput) const
+        {
+            auto const input = std::clamp(aInput, iBreakpoints.front(), iBreakpoints.back());
+            auto const index = segment(input);
+            auto const width = iBreakpoints[index + 1u] - iBreakpoints[index];
+            auto const fraction = static_cast<value_type>((input - iBreakpoints[index]) / width);
+            if constexpr (Interpolation == interpolation::linear)
+                return detail::lerp(iValues[index], iValues[index + 1u], fraction);
+            else
+                return detail::hermite(iValues[index], iValues[index + 1u],
+                    iSlopes[index] * static_cast<value_type>(width), iSlopes[index + 1u] * static_cast<value_type>(width), fraction);
+        }
+    private:
+        std::vector<input_value_type> iBreakpoints;
+        std::vector<value_type> iValues;
+        std::vector<value_type> iSlopes;
+        std::vector<input_value_type> iSearch;
+        std::vector<std::uint32_t> iRank;
+    };
+}
@@ -0,0 +1,242 @@
+// math.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    template <typename T>
+    struct is_scalar_quantity : std::false_type {};
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    struct is_scalar_quantity<scalar<T, Dimension, Exponents, Ratios>> : std::true_type {};
+    template <typename T>
+    constexpr bool is_scalar_quantity_v = is_scalar_quantity<std::remove_cv_t<T>>::value;
+
+    namespace detail
+    {
+        template <typename T>
+        inline constexpr auto value_of(T const& aValue)
+        {
+            if constexpr (is_scalar_quantity_v<T>)
+                return static_cast<typename T::value_type>(aValue);
+            else
+                return aValue;
+        }
+
+        template <dimensional_exponent N, typename T>
+        inline constexpr T integer_power(T aValue)
+        {
+            if constexpr (N < 0)
+                return static_cast<T>(1.0) / integer_power<-N>(aValue);
+            else if constexpr (N == 0)
+                return static_cast<T>(1.0);
+            else if constexpr (N % 2 == 0)
+            {
+                auto const half = integer_power<N / 2>(aValue);
+                return half * half;
+            }
+            else
+                return aValue * integer_power<N - 1>(aValue);
+        }
+
+        // aBase^aRoot > aValue, without overflow
+        consteval bool power_exceeds(std::intmax_t aBase, dimensional_exponent aRoot, std::intmax_t aValue)
+        {
+            std::intmax_t power = 1;
+            for (dimensional_exponent i = 0; i < aRoot; ++i)
+            {
+                if (aBase != 0 && power > aValue / aBase)
+                    return true;
+                power *= aBase;
+            }
+            return power > aValue;
+        }
+
+        consteval std::intmax_t integer_root(std::intmax_t aValue, dimensional_exponent aRoot)
+        {
+            std::intmax_t low = 0;
+            std::intmax_t high = 1;
+            while (!power_exceeds(high, aRoot, aValue))
+                high *= 2;
+            while (high - low > 1)
+            {
+                auto const middle = low + (high - low) / 2;
+                if (power_exceeds(middle, aRoot, aValue))
+                    high = middle;
+                else
+                    low = middle;
+            }
+            return low;
+        }
+
+        template <typename Ratio, dimensional_exponent N>
+        struct ratio_power { using result_type = ratio_multiply<Ratio, typename ratio_power<Ratio, N - 1>::result_type>; };
+        template <typename Ratio>
+        struct ratio_power<Ratio, 0> { using result_type = one; };
+
+        template <typename Ratio, dimensional_exponent N>
+        struct ratio_root
+        {
+            static constexpr std::intmax_t num = integer_root(Ratio::num, N);
+            static constexpr std::intmax_t den = integer_root(Ratio::den, N);
+            static_assert(power_exceeds(num, N, Ratio::num - 1) && power_exceeds(den, N, Ratio::den - 1) && Ratio::exp % N == 0 && Ratio::exp2 % N == 0 && Ratio::exp_pi % N == 0,
+                "neounit: magnitude has no exact root");
+            using result_type = ratio<num, den, Ratio::exp / N, Ratio::exp2 / N, Ratio::exp_pi / N>;
+        };
+
+        // Ratios of a power or root of a unit: per slot ratios hold the multiple of a single unit and are unchanged
+        // (inverted for negative powers); a single magnitude is raised to the power.
+        template <typename Ratios, dimensional_exponent N>
+        struct power_ratios { using result_type = std::conditional_t<(N < 0), typename Ratios::inverse_t, Ratios>; };
+        template <typename Ratio, dimensional_exponent N>
+        struct power_ratios<magnitude<Ratio>, N>
+        {
+            using result_type = std::conditional_t<(N < 0), 
+                typename magnitude<typename ratio_power<Ratio, (N < 0 ? -N : N)>::result_type>::inverse_t, 
+                magnitude<typename ratio_power<Ratio, (N < 0 ? -N : N)>::result_type>>;
+        };
+        template <typename Ratios, dimensional_exponent N>
+        struct root_ratios { using result_type = Ratios; };
+        template <typename Ratio, dimensional_exponent N>
+        struct root_ratios<magnitude<Ratio>, N> { using result_type = magnitude<typename ratio_root<Ratio, N>::result_type>; };
+    }
+
+    // Roots and powers act on the exponents only: a ratio slot holds the multiple of a single unit
+    // (e.g. km^2 is kilo in the Length slot) so it is unchanged by sqrt and cbrt and inverted by
+    // negative powers exactly as for operator/. A single magnitude (canonical_t) is raised to the
+    // power or must have an exact root.
+
+    template <typename T, typename Dimension, dimensional_exponent... Exponents, typename Ratios>
+    inline scalar<T, Dimension, exponents<(Exponents / 2)...>, typename detail::root_ratios<Ratios, 2>::result_type> sqrt(
+        scalar<T, Dimension, exponents<Exponents...>, Ratios> const& aValue)
+    {
+        static_assert(((Exponents % 2 == 0) && ...), "neounit::sqrt: dimensional exponents must be even");
+        return std::sqrt(static_cast<T>(aValue));
+    }
+
+    template <typename T, typename Dimension, dimensional_exponent... Exponents, typename Ratios>
+    inline scalar<T, Dimension, exponents<(Exponents / 3)...>, typename detail::root_ratios<Ratios, 3>::result_type> cbrt(
+        scalar<T, Dimension, exponents<Exponents...>, Ratios> const& aValue)
+    {
+        static_assert(((Exponents % 3 == 0) && ...), "neounit::cbrt: dimensional exponents must be multiples of 3");
+        return std::cbrt(static_cast<T>(aValue));
+    }
+
+    template <dimensional_exponent N, typename T, typename Dimension, dimensional_exponent... Exponents, typename Ratios>
+    inline constexpr auto pow(scalar<T, Dimension, exponents<Exponents...>, Ratios> const& aValue)
+    {
+        if constexpr (N == 0)
+            return static_cast<T>(1.0);
+        else
+        {
+            using result_ratios = typename detail::power_ratios<Ratios, N>::result_type;
+            return scalar<T, Dimension, exponents<(Exponents * N)...>, result_ratios>{ detail::integer_power<N>(static_cast<T>(aValue)) };
+        }
+    }
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios, typename... Rest>
+    inline scalar<T, Dimension, Exponents, Ratios> hypot(
+        scalar<T, Dimension, Exponents, Ratios> const& aFirst, scalar<T, Dimension, Exponents, Ratios> const& aSecond, Rest const&... aRest)
+    {
+        static_assert((std::is_same_v<Rest, scalar<T, Dimension, Exponents, Ratios>> && ...), "neounit::hypot: arguments must have the same unit");
+        if constexpr (sizeof...(Rest) == 0)
+            return std::hypot(static_cast<T>(aFirst), static_cast<T>(aSecond));
+        else if constexpr (sizeof...(Rest) == 1)
+            return std::hypot(static_cast<T>(aFirst), static_cast<T>(aSecond), static_cast<T>(aRest)...);
+        else
+            return hypot(scalar<T, Dimension, Exponents, Ratios>{ std::hypot(static_cast<T>(aFirst), static_cast<T>(aSecond)) }, aRest...);
+    }
+
+    /// aMultiplicand * aMultiplier + aAddend with a single rounding; the product must have the dimensions of
+    /// aAddend and is expressed in aAddend's unit (the unit conversion, if any, is a compile time constant).
+    template <typename Multiplicand, typename Multiplier, typename Addend>
+    inline std::enable_if_t<is_scalar_quantity_v<Multiplicand> || is_scalar_quantity_v<Multiplier> || is_scalar_quantity_v<Addend>, Addend> fma(
+        Multiplicand const& aMultiplicand, Multiplier const& aMultiplier, Addend const& aAddend)
+    {
+        using product_type = decltype(aMultiplicand * aMultiplier);
+        if constexpr (!is_scalar_quantity_v<product_type> || !is_scalar_quantity_v<Addend>)
+        {
+            static_assert(std::is_same_v<product_type, Addend>, "neounit::fma: product and addend must have the same dimensions");
+            return std::fma(detail::value_of(aMultiplicand), detail::value_of(aMultiplier), detail::value_of(aAddend));
+        }
+        else
+        {
+            static_assert(std::is_same_v<typename product_type::exponents_type, typename Addend::exponents_type>, "neounit::fma: product and addend must have the same dimensions");
+            using value_type = typename Addend::value_type;
+            constexpr value_type coefficient = detail::coefficient<value_type>(
+                typename Addend::exponents_type{}, typename product_type::exponents_type{}, typename Addend::ratios_type{}, typename product_type::ratios_type{});
+            if constexpr (coefficient == static_cast<value_type>(1.0))
+                return std::fma(detail::value_of(aMultiplicand), detail::value_of(aMultiplier), detail::value_of(aAddend));
+            else
+                return std::fma(detail::value_of(aMultiplicand) * coefficient, detail::value_of(aMultiplier), detail::value_of(aAddend));
+        }
+    }
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline constexpr scalar<T, Dimension, Exponents, Ratios> abs(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return static_cast<T>(aValue) < static_cast<T>(0) ? -static_cast<T>(aValue) : static_cast<T>(aValue);
+    }
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline scalar<T, Dimension, Exponents, Ratios> floor(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return std::floor(static_cast<T>(aValue));
+    }
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline scalar<T, Dimension, Exponents, Ratios> ceil(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return std::ceil(static_cast<T>(aValue));
+    }
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline scalar<T, Dimension, Exponents, Ratios> round(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return std::round(static_cast<T>(aValue));
+    }
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline scalar<T, Dimension, Exponents, Ratios> trunc(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return std::trunc(static_cast<T>(aValue));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+// mdspan.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <version>
+#ifdef __cpp_lib_mdspan
+#include <mdspan>
+#endif
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    // mdspan accessor policies presenting raw value_type storage (e.g. a 3-D double buffer) as quantities without
+    // copying; they meet the standard AccessorPolicy requirements and so work with any layout mapping, e.g.
+    //
+    //     std::mdspan<si::kelvin, std::dextents<std::size_t, 3>, std::layout_right, quantity_accessor<si::kelvin>> field{ buffer.data(), nx, ny, nz };
+    //     field[i, j, k] += 1.0_K;
+    //     si::kelvin const t = field[i, j, k];
+    //
+    // quantity_mdspan and converting_mdspan name these types when the standard library provides std::mdspan; no
+    // toolchain the tests are currently built with does (GCC 12 has no <mdspan>), so that path is untested.
+
+    /// Reference to a quantity stored as its raw value.
+    template <typename Scalar>
+    class quantity_reference
+    {
+    public:
+        using quantity_type = std::remove_const_t<Scalar>;
+        using value_type = typename quantity_type::value_type;
+        using pointer = std::conditional_t<std::is_const_v<Scalar>, value_type const*, value_type*>;
+    public:
+        constexpr explicit quantity_reference(pointer aValue) : iValue{ aValue }
+        {
+        }
+    public:
+        constexpr operator quantity_type() const
+        {
+            return *iValue;
+        }
+        constexpr quantity_reference const& operator=(quantity_type const& aValue) const requires (!std::is_const_v<Scalar>)
+        {
+            *iValue = static_cast<value_type>(aValue);
+            return *this;
+        }
+        constexpr quantity_reference const& operator=(quantity_reference const& aOther) const requires (!std::is_const_v<Scalar>)
+        {
+            *iValue = *aOther.iValue;
+            return *this;
+        }
+        constexpr quantity_reference const& operator+=(quantity_type const& aValue) const requires (!std::is_const_v<Scalar>)
+        {
+            *iValue += static_cast<value_type>(aValue);
+            return *this;
+        }
+        constexpr quantity_reference const& operator-=(quantity_type const& aValue) const requires (!std::is_const_v<Scalar>)
+        {
+            *iValue -= static_cast<value_type>(aValue);
+            return *this;
+        }
+        constexpr quantity_reference const& operator*=(value_type aValue) const requires (!std::is_const_v<Scalar>)
+        {
+            *iValue *= aValue;
+            return *this;
+        }
+        constexpr quantity_reference const& operator/=(value_type aValue) const requires (!std::is_const_v<Scalar>)
+        {
+            *iValue /= aValue;
+            return *this;
+        }
+    public:
+        constexpr quantity_type value() const
+        {
+            return *iValue;
+        }
+    private:
+        pointer iValue;
+    };
+
+    template <typename T>
+    constexpr bool is_quantity_reference_v = false;
+    template <typename Scalar>
+    constexpr bool is_quantity_reference_v<quantity_reference<Scalar>> = true;
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr decltype(auto) referenced(T const& aValue)
+        {
+            if constexpr (is_quantity_reference_v<T>)
+                return aValue.value();
+            else
+                return (aValue);
+        }
+    }
+
+    // Arithmetic and comparisons on references forward to the referenced quantities: the scalar operators are
+    // templates and so never consider the conversion to quantity_type, e.g. for a stencil
+    //
+    //     out.access(y, i) = (in.access(x, i - 1) + in.access(x, i + 1)) * 0.5;
+
+    template <typename Scalar>
+    constexpr auto operator+(quantity_reference<Scalar> const& aValue)
+    {
+        return aValue.value();
+    }
+    template <typename Scalar>
+    constexpr auto operator-(quantity_reference<Scalar> const& aValue) -> decltype(-aValue.value())
+    {
+        return -aValue.value();
+    }
+
+    #define define_quantity_reference_operator(Op)\
+    template <typename Lhs, typename Rhs>\
+        requires (is_quantity_reference_v<Lhs> || is_quantity_reference_v<Rhs>)\
+    constexpr auto operator Op(Lhs const& aLhs, Rhs const& aRhs) -> decltype(detail::referenced(aLhs) Op detail::referenced(aRhs))\
+    {\
+        return detail::referenced(aLhs) Op detail::referenced(aRhs);\
+    }
+
+    define_quantity_reference_operator(+)
+    define_quantity_reference_operator(-)
+    define_quantity_reference_operator(*)
+    define_quantity_reference_operator(/)
+    define_quantity_reference_operator(==)
+    define_quantity_reference_operator(<)
+    define_quantity_reference_operator(<=)
+    define_quantity_reference_operator(>)
+    define_quantity_reference_operator(>=)
+
+    #undef define_quantity_reference_operator
+
+    /// Accessor yielding Scalar (or Scalar const) references over raw value_type storage.
+    template <typename Scalar>
+    struct quantity_accessor
+    {
+        using offset_policy = quantity_accessor;
+        using element_type = Scalar;
+        using reference = quantity_reference<Scalar>;
+        using data_handle_type = typename quantity_reference<Scalar>::pointer;
+
+        constexpr quantity_accessor() noexcept = default;
+        template <typename OtherScalar>
+            requires std::is_convertible_v<typename quantity_accessor<OtherScalar>::data_handle_type, data_handle_type>
+        constexpr quantity_accessor(quantity_accessor<OtherScalar> const&) noexcept
+        {
+        }
+
+        constexpr reference access(data_handle_type aData, std::size_t aIndex) const noexcept
+        {
+            return reference{ aData + aIndex };
+        }
+        constexpr data_handle_type offset(data_handle_type aData, std::size_t aIndex) const noexcept
+        {
+            return aData + aIndex;
+        }
+    };
+
+    /// Read only accessor over raw storage of From quantities yielding To quantities; the conversion factor is
+    /// folded at compile time so each read is one multiply (none if the units are the same).
+    template <typename To, typename From>
+    struct converting_accessor
+    {
+        static_assert(std::is_same_v<typename To::exponents_type, typename From::exponents_type>, "neounit::converting_accessor: incompatible dimensions");
+
+        using offset_policy = converting_accessor;
+        using element_type = To const;
+        using reference = To;
+        using data_handle_type = typename From::value_type const*;
+
+        static constexpr typename To::value_type factor = detail::coefficient<typename To::value_type>(
+            typename To::exponents_type{}, typename From::exponents_type{}, typename To::ratios_type{}, typename From::ratios_type{});
+
+        constexpr reference access(data_handle_type aData, std::size_t aIndex) const noexcept
+        {
+            if constexpr (factor == static_cast<typename To::value_type>(1.0))
+                return static_cast<typename To::value_type>(aData[aIndex]);
+            else
+                return static_cast<typename To::value_type>(aData[aIndex]) * factor;
+        }
+        constexpr data_handle_type offset(data_handle_type aData, std::size_t aIndex) const noexcept
+        {
+            return aData + aIndex;
+        }
+    };
+
+#ifdef __cpp_lib_mdspan
+    template <typename Scalar, typename Extents, typename Layout = std::layout_right>
+    using quantity_mdspan = std::mdspan<Scalar, Extents, Layout, quantity_accessor<Scalar>>;
+
+    template <typename To, typename From, typename Extents, typename Layout = std::layout_right>
+    using converting_mdspan = std::mdspan<To const, Extents, Layout, converting_accessor<To, From>>;
+#endif
+}
@@ -0,0 +1,356 @@
+// ode.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+#include <neounit/math.hpp>
+#include <neounit/si.hpp>
+#include <neounit/record.hpp>
+
+namespace neounit
+{
+    // Fixed step (RK4) and adaptive (Dormand-Prince 5(4)) integrators whose state is a std::tuple or an aggregate
+    // of quantities, e.g.
+    //
+    //     struct body { si::metre position; decltype(si::metre{} / si::second{}) velocity; };
+    //     struct body_rate { decltype(si::metre{} / si::second{}) velocity; decltype(si::metre{} / si::second{} / si::second{}) acceleration; };
+    //     auto next = rk4_step([](si::second, body const& b) { return body_rate{ b.velocity, b.position * -k }; }, t, state, 1.0_ms);
+    //
+    // The system returns the derivative of each state field, which must have that field's unit per second; this is
+    // checked at compile time. The time step may be in any unit of time (e.g. si::millisecond) and is converted to
+    // seconds by a factor folded at compile time. Tableau weights are template arguments so that zero weights cost
+    // nothing.
+
+    namespace detail
+    {
+        template <typename T>
+        struct is_tuple : std::false_type {};
+        template <typename... T>
+        struct is_tuple<std::tuple<T...>> : std::true_type {};
+
+        /// std::tuple of references to the fields of a state.
+        template <typename State>
+        constexpr auto state_fields(State& aState)
+        {
+            if constexpr (is_tuple<std::remove_const_t<State>>::value)
+                return std::apply([](auto&... aFields) { return std::tie(aFields...); }, aState);
+            else
+                return apply_fields(aState, [](auto&... aFields) { return std::tie(aFields...); });
+        }
+
+        template <typename State>
+        using state_fields_t = decltype(state_fields(std::declval<State&>()));
+
+        template <typename State>
+        constexpr std::size_t state_size_v = std::tuple_size_v<state_fields_t<State>>;
+
+        template <typename State, std::size_t I>
+        using state_field_t = std::remove_cvref_t<std::tuple_element_t<I, state_fields_t<State>>>;
+
+        template <typename Duration>
+        constexpr void check_duration()
+        {
+            static_assert(std::is_same_v<typename Duration::exponents_type, typename si::second::exponents_type>, "neounit::ode: time step is not a duration");
+        }
+
+        template <typename State, typename Derivative, std::size_t... I>
+        constexpr void check_derivative(std::index_sequence<I...>)
+        {
+            static_assert(state_size_v<State> == state_size_v<Derivative>, "neounit::ode: derivative has a different number of fields to state");
+            static_assert((std::is_same_v<typename decltype(std::declval<state_field_t<Derivative, I>>() * std::declval<si::second>())::exponents_type,
+                typename state_field_t<State, I>::exponents_type> && ...), "neounit::ode: derivative field is not state field per unit time");
+        }
+
+        template <typename State, typename Derivative, typename Duration>
+        constexpr void check_system()
+        {
+            check_duration<Duration>();
+            check_derivative<State, Derivative>(std::make_index_sequence<state_size_v<State>>{});
+        }
+
+        // sum over stages J of (aStep * Weights[J]) * (field I of derivative J) in the state field's unit, skipping zero
+        // weights; scaling the step rather than the derivative lets the step weight fold to a constant
+        template <std::size_t I, auto Weights, typename Field, std::size_t J = 0, typename Derivatives, typename Sum>
+        constexpr auto weighted_sum(Derivatives const& aDerivatives, si::second const& aStep, Sum const& aSum)
+        {
+            if constexpr (J == Weights.size())
+                return aSum;
+            else if constexpr (Weights[J] == 0.0)
+                return weighted_sum<I, Weights, Field, J + 1>(aDerivatives, aStep, aSum);
+            else
+            {
+                auto const term = conversion_cast<Field>(std::get<I>(std::get<J>(aDerivatives)) * (aStep * static_cast<typename si::second::value_type>(Weights[J])));
+                if constexpr (std::is_same_v<Sum, std::nullptr_t>)
+                    return weighted_sum<I, Weights, Field, J + 1>(aDerivatives, aStep, term);
+                else
+                    return weighted_sum<I, Weights, Field, J + 1>(aDerivatives, aStep, aSum + term);
+            }
+        }
+
+        template <auto Weights, typename State, typename Derivatives, std::size_t... I>
+        constexpr State advance_fields(State const& aState, si::second const& aStep, Derivatives const& aDerivatives, std::index_sequence<I...>)
+        {
+            State result = aState;
+            auto const from = state_fields(aState);
+            auto to = state_fields(result);
+            ((std::get<I>(to) = std::get<I>(from) + weighted_sum<I, Weights, state_field_t<State, I>>(aDerivatives, aStep, nullptr)), ...);
+            return result;
+        }
+
+        /// aState + aStep * sum(Weights[j] * aDerivatives[j]), field by field.
+        template <auto Weights, typename State, typename... Derivative>
+        constexpr State advance(State const& aState, si::second const& aStep, Derivative const&... aDerivatives)
+        {
+            static_assert(sizeof...(Derivative) == Weights.size());
+            return advance_fields<Weights>(aState, aStep, std::make_tuple(state_fields(aDerivatives)...), std::make_index_sequence<state_size_v<State>>{});
+        }
+
+        template <typename System, typename Duration, typename State>
+        using derivative_t = std::remove_cvref_t<std::invoke_result_t<System&, Duration const&, State const&>>;
+
+        template <std::size_t N>
+        using tableau_row = std::array<double, N>;
+
+        constexpr tableau_row<1> rk4_a2{ 0.5 };
+        constexpr tableau_row<2> rk4_a3{ 0.0, 0.5 };
+        constexpr tableau_row<3> rk4_a4{ 0.0, 0.0, 1.0 };
+        constexpr tableau_row<4> rk4_b{ 1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0 };
+
+        constexpr tableau_row<1> dp_a2{ 1.0 / 5.0 };
+        constexpr tableau_row<2> dp_a3{ 3.0 / 40.0, 9.0 / 40.0 };
+        constexpr tableau_row<3> dp_a4{ 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0 };
+        constexpr tableau_row<4> dp_a5{ 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0 };
+        constexpr tableau_row<5> dp_a6{ 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0 };
+        constexpr tableau_row<6> dp_b{ 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0 };
+        // fifth order minus embedded fourth order weights
+        constexpr tableau_row<7> dp_e{ 71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0 };
+    }
+
+    /// One classical fourth order Runge-Kutta step of aStep from time aTime.
+    template <typename System, typename Time, typename State, typename Duration>
+    constexpr State rk4_step(System&& aSystem, Time const& aTime, State const& aState, Duration const& aStep)
+    {
+        using derivative_type = detail::derivative_t<System, Time, State>;
+        detail::check_duration<Time>();
+        detail::check_system<State, derivative_type, Duration>();
+        using value_type = typename Time::value_type;
+        auto const step = conversion_cast<Time>(aStep);
+        auto const half = step * static_cast<value_type>(0.5);
+        auto const h = conversion_cast<si::second>(aStep);
+        derivative_type const k1 = aSystem(aTime, aState);
+        derivative_type const k2 = aSystem(aTime + half, detail::advance<detail::rk4_a2>(aState, h, k1));
+        derivative_type const k3 = aSystem(aTime + half, detail::advance<detail::rk4_a3>(aState, h, k1, k2));
+        derivative_type const k4 = aSystem(aTime + step, detail::advance<detail::rk4_a4>(aState, h, k1, k2, k3));
+        return detail::advance<detail::rk4_b>(aState, h, k1, k2, k3, k4);
+    }
+
+    /// aSteps fixed RK4 steps of aStep from time aTime.
+    template <typename System, typename Time, typename State, typename Duration>
+    constexpr State rk4(System&& aSystem, Time aTime, State aState, Duration const& aStep, std::size_t aSteps)
+    {
+        auto const step = conversion_cast<Time>(aStep);
+        for (std::size_t i = 0; i < aSteps; ++i, aTime = aTime + step)
+            aState = rk4_step(aSystem, aTime, aState, aStep);
+        return aState;
+    }
+
+    template <typename State, typename Duration>
+    struct integration_result
+    {
+        State state;
+        Duration time;
+        Duration step;
+        std::size_t accepted;
+        std::size_t rejected;
+    };
+
+    /// Integrates from aTime to aEnd with the Dormand-Prince 5(4) embedded pair, adapting the step (initially
+    /// aStep) so that the error in each field stays within aAbsoluteTolerance (a state, so each field's tolerance
+    /// is in that field's unit) plus aRelativeTolerance times the field's magnitude.
+    template <typename System, typename Duration, typename State>
+    integration_result<State, Duration> dormand_prince(System&& aSystem, Duration aTime, State aState, Duration const& aEnd, Duration aStep,
+        typename Duration::value_type aRelativeTolerance, State const& aAbsoluteTolerance, std::size_t aMaximumSteps = 1000000u)
+    {
+        using derivative_type = detail::derivative_t<System, Duration, State>;
+        detail::check_system<State, derivative_type, Duration>();
+        using value_type = typename Duration::value_type;
+        using namespace detail;
+        integration_result<State, Duration> result{ aState, aTime, aStep, 0u, 0u };
+        derivative_type k1 = aSystem(aTime, aState);
+        while (result.time < aEnd && result.accepted + result.rejected < aMaximumSteps)
+        {
+            auto const step = std::min(result.step, aEnd - result.time);
+            auto const h = conversion_cast<si::second>(step);
+            auto const t = result.time;
+            auto const& y = result.state;
+            derivative_type const k2 = aSystem(t + step * static_cast<value_type>(1.0 / 5.0), advance<dp_a2>(y, h, k1));
+            derivative_type const k3 = aSystem(t + step * static_cast<value_type>(3.0 / 10.0), advance<dp_a3>(y, h, k1, k2));
+            derivative_type const k4 = aSystem(t + step * static_cast<value_type>(4.0 / 5.0), advance<dp_a4>(y, h, k1, k2, k3));
+            derivative_type const k5 = aSystem(t + step * static_cast<value_type>(8.0 / 9.0), advance<dp_a5>(y, h, k1, k2, k3, k4));
+            derivative_type const k6 = aSystem(t + step, advance<dp_a6>(y, h, k1, k2, k3, k4, k5));
+            State const next = advance<dp_b>(y, h, k1, k2, k3, k4, k5, k6);
+            derivative_type const k7 = aSystem(t + step, next);
+            // the error estimate is the difference of the two solutions; advancing a zero state gives it in state units
+            State zero{};
+            State const error = advance<dp_e>(zero, h, k1, k2, k3, k4, k5, k6, k7);
+            value_type norm{};
+            auto const errorFields = state_fields(error);
+            auto const fromFields = state_fields(y);
+            auto const toFields = state_fields(next);
+            auto const toleranceFields = state_fields(aAbsoluteTolerance);
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                ((norm = std::max<value_type>(norm, std::abs(static_cast<value_type>(std::get<I>(errorFields))) /
+                    (static_cast<value_type>(std::get<I>(toleranceFields)) + aRelativeTolerance *
+                        std::max(std::abs(static_cast<value_type>(std::get<I>(fromFields))), std::abs(static_cast<value_type>(std::get<I>(toFields))))))), ...);
+            }(std::make_index_sequence<state_size_v<State>>{});
+            if (norm <= 1)
+            {
+                result.state = next;
+                result.time = t + step;
+                k1 = k7;
+                ++result.accepted;
+            }
+            else
+                ++result.rejected;
+            auto const factor = norm == 0 ? static_cast<value_type>(5) :
+                std::clamp(static_cast<value_type>(0.9) * std::pow(norm, static_cast<value_type>(-0.2)), static_cast<value_type>(0.2), static_cast<value_type>(5));
+            result.step = step * factor;
+        }
+        return result;
+    }
+
+    /// Structure of arrays storage for many independent systems with the same state type; each state field is
+    /// stored contiguously as raw values so that batch integration vectorizes across systems.
+    template <typename State>
+    class state_array
+    {
+    private:
+        template <typename Indices>
+        struct storage;
+        template <std::size_t... I>
+        struct storage<std::index_sequence<I...>>
+        {
+            using type = std::tuple<std::vector<typename detail::state_field_t<State, I>::value_type>...>;
+        };
+        using indices = std::make_index_sequence<detail::state_size_v<State>>;
+    public:
+        using state_type = State;
+    public:
+        explicit state_array(std::size_t aSize = 0u)
+        {
+            resize(aSize);
+        }
+    public:
+        std::size_t size() const
+        {
+            return std::get<0>(iFields).size();
+        }
+        void resize(std::size_t aSize)
+        {
+            std::apply([&](auto&... aFields) { (aFields.resize(aSize), ...); }, iFields);
+        }
+        state_type get(std::size_t aIndex) const
+        {
+            state_type result{};
+            auto fields = detail::state_fields(result);
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                ((std::get<I>(fields) = std::get<I>(iFields)[aIndex]), ...);
+            }(indices{});
+            return result;
+        }
+        void set(std::size_t aIndex, state_type const& aState)
+        {
+            auto const fields = detail::state_fields(aState);
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                ((std::get<I>(iFields)[aIndex] = static_cast<typename detail::state_field_t<State, I>::value_type>(std::get<I>(fields))), ...);
+            }(indices{});
+        }
+        /// Raw values of field I of every system.
+        template <std::size_t I>
+        auto& field()
+        {
+            return std::get<I>(iFields);
+        }
+        template <std::size_t I>
+        auto const& field() const
+        {
+            return std::get<I>(iFields);
+        }
+        /// aSteps RK4 steps of aStep for every system.
+        template <typename System, typename Time, typename Duration>
+        void rk4(System&& aSystem, Time aTime, Duration const& aStep, std::size_t aSteps)
+        {
+            auto const timeStep = conversion_cast<Time>(aStep);
+            // a local copy of the step; the reference could otherwise alias the stored fields
+            Duration const systemStep = aStep;
+            for (std::size_t step = 0; step < aSteps; ++step, aTime = aTime + timeStep)
+            {
+                auto const data = std::apply([](auto&... aFields) { return std::tuple{ aFields.data()... }; }, iFields);
+                std::size_t const count = size();
+                for (std::size_t system = 0; system < count; ++system)
+                {
+                    state_type state{};
+                    auto fields = detail::state_fields(state);
+                    [&]<std::size_t... I>(std::index_sequence<I...>)
+                    {
+                        ((std::get<I>(fields) = std::get<I>(data)[system]), ...);
+                    }(indices{});
+                    state = rk4_step(aSystem, aTime, state, systemStep);
+                    auto const next = detail::state_fields(state);
+                    [&]<std::size_t... I>(std::index_sequence<I...>)
+                    {
+                        ((std::get<I>(data)[system] = static_cast<typename detail::state_field_t<State, I>::value_type>(std::get<I>(next))), ...);
+                    }(indices{});
+                }
+            }
+        }
+    private:
+        typename storage<indices>::type iFields;
+    };
+}
@@ -0,0 +1,219 @@
+// packed.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <bit>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    // Fields of device packets given as a raw integer, its byte order and the value of its least significant bit,
+    // e.g. a big-endian int16 in hundredths of a degree Celsius:
+    //
+    //     using board_temperature = packed_quantity<std::int16_t, std::endian::big, centi, si::degC<>>;
+    //     auto const t = board_temperature::read<si::mK<1>>(std::span{ packet }, 6u);
+    //
+    // The byte order, widening, LSB and unit conversion are folded into one multiply by a factor computed at
+    // compile time. read_packets decodes the field from an array of packets; where the fields of four packets
+    // fit in 16 bytes and SSSE3 is enabled they are byte swapped and widened with one shuffle per four values.
+
+    /// Raw integer of Bytes bytes (e.g. 24 bit fields) for packed_quantity.
+    template <std::size_t Bytes, bool Signed>
+    struct packed_integer
+    {
+        static_assert(Bytes >= 1u && Bytes <= 8u, "neounit::packed_integer: unsupported size");
+    };
+
+    using packed_int24 = packed_integer<3u, true>;
+    using packed_uint24 = packed_integer<3u, false>;
+
+    namespace detail
+    {
+        template <typename Raw>
+        struct packed_traits
+        {
+            static_assert(std::is_integral_v<Raw> && !std::is_same_v<Raw, bool>, "neounit::packed_quantity: raw type must be an integer");
+            static constexpr std::size_t size = sizeof(Raw);
+            static constexpr bool is_signed = std::is_signed_v<Raw>;
+        };
+        template <std::size_t Bytes, bool Signed>
+        struct packed_traits<packed_integer<Bytes, Signed>>
+        {
+            static constexpr std::size_t size = Bytes;
+            static constexpr bool is_signed = Signed;
+        };
+
+        template <typename Raw>
+        using packed_wide_t = std::conditional_t<(packed_traits<Raw>::size <= 4u),
+            std::conditional_t<packed_traits<Raw>::is_signed, std::int32_t, std::uint32_t>,
+            std::conditional_t<packed_traits<Raw>::is_signed, std::int64_t, std::uint64_t>>;
+
+        /// The raw integer at aInput widened to 32 or 64 bits; compilers turn the byte loop into a load and a
+        /// byte swap where one is needed.
+        template <typename Raw, std::endian Endianness>
+        inline packed_wide_t<Raw> load_packed(std::byte const* aInput)
+        {
+            using traits = packed_traits<Raw>;
+            using wide_type = packed_wide_t<Raw>;
+            using bits_type = std::make_unsigned_t<wide_type>;
+            bits_type bits = 0u;
+            for (std::size_t i = 0; i < traits::size; ++i)
+                bits = static_cast<bits_type>(bits << 8) | static_cast<bits_type>(aInput[Endianness == std::endian::big ? i : traits::size - 1u - i]);
+            if constexpr (traits::is_signed && traits::size < sizeof(wide_type))
+            {
+                constexpr unsigned shift = (sizeof(wide_type) - traits::size) * 8u;
+                return static_cast<wide_type>(static_cast<wide_type>(bits << shift) >> shift);
+            }
+            else
+                return static_cast<wide_type>(bits);
+        }
+    }
+
+    template <typename Raw, std::endian Endianness, typename LsbRatio, typename Unit>
+    struct packed_quantity
+    {
+        static_assert(Endianness == std::endian::big || Endianness == std::endian::little, "neounit::packed_quantity: unsupported byte order");
+
+        using raw_type = Raw;
+        using lsb_ratio = LsbRatio;
+        using unit_type = Unit;
+        static constexpr std::endian endianness = Endianness;
+        static constexpr std::size_t size = detail::packed_traits<Raw>::size;
+
+        /// The value of one raw count in To, i.e. the LSB converted from Unit.
+        template <typename To = Unit>
+        static constexpr compute_type_t<typename To::value_type> scale()
+        {
+            static_assert(std::is_same_v<typename To::dimension_type, typename Unit::dimension_type> &&
+                std::is_same_v<typename To::exponents_type, typename Unit::exponents_type>, "neounit::packed_quantity: incompatible dimensions");
+            static_assert(std::is_floating_point_v<compute_type_t<typename To::value_type>>, "neounit::packed_quantity: value type must be floating point");
+            using conversion = typename detail::conversion_ratio<typename To::exponents_type, typename Unit::exponents_type, typename To::ratios_type, typename Unit::ratios_type>::result_type;
+            return detail::ratio_value<compute_type_t<typename To::value_type>, ratio_multiply<LsbRatio, conversion>>();
+        }
+
+        /// Decodes the field at aInput, which must hold size bytes.
+        template <typename To = Unit>
+        static To read(std::byte const* aInput)
+        {
+            using value_type = typename To::value_type;
+            using compute = compute_type_t<value_type>;
+            constexpr compute factor = scale<To>();
+            return static_cast<value_type>(static_cast<compute>(detail::load_packed<Raw, Endianness>(aInput)) * factor);
+        }
+        /// Decodes the field aOffset bytes into aInput; throws std::invalid_argument if it does not fit.
+        template <typename To = Unit>
+        static To read(std::span<std::byte const> aInput, std::size_t aOffset = 0u)
+        {
+            if (aOffset > aInput.size() || aInput.size() - aOffset < size)
+                throw std::invalid_argument("neounit::packed_quantity: truncated input");
+            return read<To>(aInput.data() + aOffset);
+        }
+        /// Decodes the field from aOutput.size() consecutive packets of aStride bytes, found aOffset bytes into
+        /// each packet; throws std::invalid_argument if the packets do not fit in aPackets.
+        template <typename To, std::size_t Extent>
+        static void read_packets(std::span<std::byte const> aPackets, std::span<To, Extent> aOutput, std::size_t aStride = size, std::size_t aOffset = 0u)
+        {
+            using value_type = typename To::value_type;
+            using compute = compute_type_t<value_type>;
+            constexpr compute factor = scale<To>();
+            auto const count = aOutput.size();
+            if (count == 0u)
+                return;
+            if (aOffset > aPackets.size() || aPackets.size() - aOffset < size)
+                throw std::invalid_argument("neounit::packed_quantity: truncated input");
+            if (count > 1u)
+            {
+                if (aOffset + size > aStride)
+                    throw std::invalid_argument("neounit::packed_quantity: fields overlap");
+                if (count - 1u > (aPackets.size() - aOffset - size) / aStride)
+                    throw std::invalid_argument("neounit::packed_quantity: truncated input");
+            }
+            auto const input = aPackets.data();
+            auto const output = aOutput.data();
+            std::size_t i = 0;
+#if defined(__SSSE3__)
+            constexpr bool shuffles = size <= 4u && (detail::packed_traits<Raw>::is_signed || size < 4u) &&
+                (std::is_same_v<value_type, float> || std::is_same_v<value_type, double>);
+            if constexpr (shuffles)
+            {
+                // fields of up to 16 packets taken by one 16 byte load, in groups of four 32 bit lanes
+                auto const fieldsPerLoad = aOffset + size <= 16u ? std::min<std::size_t>((16u - aOffset - size) / aStride + 1u, 16u) / 4u * 4u : 0u;
+                if (fieldsPerLoad != 0u)
+                {
+                    alignas(16) std::int8_t masks[4][16];
+                    for (std::size_t field = 0; field < fieldsPerLoad; ++field)
+                        for (std::size_t byte = 0; byte < 4u; ++byte)
+                            masks[field / 4u][field % 4u * 4u + byte] = static_cast<std::int8_t>(byte >= size ? -1 :
+                                field * aStride + aOffset + (Endianness == std::endian::big ? size - 1u - byte : byte));
+                    constexpr int shift = static_cast<int>(32u - size * 8u);
+                    for (; i + fieldsPerLoad <= count && i * aStride + 16u <= aPackets.size(); i += fieldsPerLoad)
+                    {
+                        auto const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(input + i * aStride));
+                        for (std::size_t group = 0; group < fieldsPerLoad / 4u; ++group)
+                        {
+                            auto lanes = _mm_shuffle_epi8(bytes, _mm_load_si128(reinterpret_cast<__m128i const*>(masks[group])));
+                            if constexpr (shift != 0 && detail::packed_traits<Raw>::is_signed)
+                                lanes = _mm_srai_epi32(_mm_slli_epi32(lanes, shift), shift);
+                            value_type block[4];
+                            if constexpr (std::is_same_v<value_type, float>)
+                                _mm_storeu_ps(block, _mm_mul_ps(_mm_cvtepi32_ps(lanes), _mm_set1_ps(factor)));
+                            else
+                            {
+                                _mm_storeu_pd(block, _mm_mul_pd(_mm_cvtepi32_pd(lanes), _mm_set1_pd(factor)));
+                                _mm_storeu_pd(block + 2, _mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(lanes, 0xEE)), _mm_set1_pd(factor)));
+                            }
+                            for (std::size_t j = 0; j < 4u; ++j)
+                                output[i + group * 4u + j] = block[j];
+                        }
+                    }
+                }
+            }
+#endif
+            for (; i < count; ++i)
+                output[i] = static_cast<value_type>(static_cast<compute>(detail::load_packed<Raw, Endianness>(input + i * aStride + aOffset)) * factor);
+        }
+    };
+}
@@ -0,0 +1,203 @@
+// ranges.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <neounit/unit.hpp>
+
+namespace neounit
+{
+    // Range adaptors between raw numbers and quantities, e.g.
+    //
+    //     auto lengths = samples | views::as_quantity<si::mm<1>> | views::convert_to<si::metre>;   // samples * 0.001
+    //     auto raw = metres | views::convert_to<si::km<1>> | views::strip_unit;
+    //
+    // Each adaptor is a transform_view over the underlying range with a function object that scales by the
+    // conversion coefficient folded at compile time; an adaptor applied to the result of another replaces it
+    // rather than wrapping it, so that a pipeline of them is still one multiply per element (none if the units
+    // are the same). The views are random access, sized and common if the underlying range is; they cannot be
+    // contiguous as their elements are computed.
+
+    namespace detail
+    {
+        /// Reads elements in (or holding raw values in) Source as Target, or as the raw value in Target if Strip.
+        template <typename Source, typename Target, bool Strip>
+        struct unit_transform
+        {
+            static_assert(std::is_same_v<typename Source::dimension_type, typename Target::dimension_type> &&
+                std::is_same_v<typename Source::exponents_type, typename Target::exponents_type>, "neounit::views: incompatible dimensions");
+
+            using source_type = Source;
+            using target_type = Target;
+            using value_type = typename Target::value_type;
+            using result_type = std::conditional_t<Strip, value_type, Target>;
+
+            template <typename Element>
+            constexpr result_type operator()(Element const& aElement) const
+            {
+                auto const raw = static_cast<typename Source::value_type>(aElement);
+                if constexpr (std::is_floating_point_v<compute_type_t<value_type>>)
+                {
+                    using compute = compute_type_t<value_type>;
+                    constexpr compute factor = coefficient<compute>(
+                        typename Target::exponents_type{}, typename Source::exponents_type{}, typename Target::ratios_type{}, typename Source::ratios_type{});
+                    if constexpr (factor == static_cast<compute>(1.0))
+                        return result_type{ static_cast<value_type>(raw) };
+                    else
+                        return result_type{ static_cast<value_type>(static_cast<compute>(raw) * factor) };
+                }
+                else if constexpr (Strip)
+                    return static_cast<value_type>(conversion_cast<Target>(Source{ raw }));
+                else
+                    return conversion_cast<Target>(Source{ raw });
+            }
+        };
+
+        template <typename Range>
+        struct unit_view_traits
+        {
+            static constexpr bool folds = false;
+            static constexpr bool strip = false;
+        };
+        template <typename Base, typename Source, typename Target, bool Strip>
+        struct unit_view_traits<std::ranges::transform_view<Base, unit_transform<Source, Target, Strip>>>
+        {
+            static constexpr bool folds = true;
+            static constexpr bool strip = Strip;
+            using source_type = Source;
+            using target_type = Target;
+        };
+
+        template <typename Source, typename Target, bool Strip, typename Range>
+        constexpr auto make_unit_view(Range&& aRange)
+        {
+            return std::ranges::transform_view{ std::views::all(std::forward<Range>(aRange)), unit_transform<Source, Target, Strip>{} };
+        }
+
+        /// The view of aRange as Target (raw values in Target if Strip) where aRange's elements are in Source,
+        /// folded into aRange if it is itself such a view of quantities.
+        template <typename Source, typename Target, bool Strip, typename Range>
+        constexpr auto apply_unit_view(Range&& aRange)
+        {
+            using traits = unit_view_traits<std::remove_cvref_t<Range>>;
+            if constexpr (traits::folds && !traits::strip)
+                return make_unit_view<typename traits::source_type, Target, Strip>(std::forward<Range>(aRange).base());
+            else
+                return make_unit_view<Source, Target, Strip>(std::forward<Range>(aRange));
+        }
+
+        template <typename Derived>
+        struct unit_adaptor
+        {
+            template <std::ranges::viewable_range Range>
+            friend constexpr auto operator|(Range&& aRange, Derived const& aAdaptor)
+            {
+                return aAdaptor(std::forward<Range>(aRange));
+            }
+        };
+
+        template <typename First, typename Second>
+        struct unit_adaptor_pipe : unit_adaptor<unit_adaptor_pipe<First, Second>>
+        {
+            First first;
+            Second second;
+
+            template <std::ranges::viewable_range Range>
+            constexpr auto operator()(Range&& aRange) const
+            {
+                return second(first(std::forward<Range>(aRange)));
+            }
+        };
+
+        template <typename First, typename Second>
+            requires std::is_base_of_v<unit_adaptor<First>, First> && std::is_base_of_v<unit_adaptor<Second>, Second>
+        constexpr auto operator|(First const& aFirst, Second const& aSecond)
+        {
+            return unit_adaptor_pipe<First, Second>{ {}, aFirst, aSecond };
+        }
+
+        template <typename Unit>
+        struct as_quantity_adaptor : unit_adaptor<as_quantity_adaptor<Unit>>
+        {
+            template <std::ranges::viewable_range Range>
+            constexpr auto operator()(Range&& aRange) const
+            {
+                static_assert(std::is_arithmetic_v<std::ranges::range_value_t<Range>>, "neounit::views::as_quantity: range of raw numbers required");
+                return make_unit_view<Unit, Unit, false>(std::forward<Range>(aRange));
+            }
+        };
+
+        template <typename To>
+        struct convert_to_adaptor : unit_adaptor<convert_to_adaptor<To>>
+        {
+            template <std::ranges::viewable_range Range>
+            constexpr auto operator()(Range&& aRange) const
+            {
+                using from_type = std::ranges::range_value_t<Range>;
+                static_assert(!std::is_arithmetic_v<from_type>, "neounit::views::convert_to: range of quantities required");
+                return apply_unit_view<from_type, To, false>(std::forward<Range>(aRange));
+            }
+        };
+
+        struct strip_unit_adaptor : unit_adaptor<strip_unit_adaptor>
+        {
+            template <std::ranges::viewable_range Range>
+            constexpr auto operator()(Range&& aRange) const
+            {
+                using from_type = std::ranges::range_value_t<Range>;
+                static_assert(!std::is_arithmetic_v<from_type>, "neounit::views::strip_unit: range of quantities required");
+                return apply_unit_view<from_type, from_type, true>(std::forward<Range>(aRange));
+            }
+        };
+    }
+
+    namespace views
+    {
+        /// Raw numbers as quantities of Unit.
+        template <typename Unit>
+        inline constexpr detail::as_quantity_adaptor<Unit> as_quantity{};
+        /// Quantities converted to To.
+        template <typename To>
+        inline constexpr detail::convert_to_adaptor<To> convert_to{};
+        /// Quantities as their raw values.
+        inline constexpr detail::strip_unit_adaptor strip_unit{};
+    }
+}
@@ -0,0 +1,208 @@
+// record.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <span>
+#include <stdexcept>
+
+#include <neounit/unit.hpp>
+#include <neounit/math.hpp>
+
+namespace neounit
+{
+    // Conversion of whole records (aggregates of quantities) between unit systems, e.g.
+    //
+    //     struct flight_imperial { imperial::foot altitude; decltype(imperial::mile{} / si::hour{}) speed; imperial::pound mass; };
+    //     struct flight_si { si::metre altitude; decltype(si::metre{} / si::second{}) speed; si::kilogram mass; };
+    //     convert_records(std::span{ imperialRecords }, std::span{ siRecords });
+    //
+    // Fields correspond by position and each is converted with its conversion factor folded at compile time.
+    // Aggregates of up to 12 fields are decomposed automatically; others opt in by specializing record_fields.
+
+    template <auto... Members>
+    struct fields {};
+
+    /// Specialize with using type = fields<&Record::member...> to list the fields of Record explicitly.
+    template <typename Record>
+    struct record_fields {};
+
+    namespace detail
+    {
+        struct any_field
+        {
+            template <typename T>
+            constexpr operator T() const;
+        };
+
+        template <typename Record, std::size_t... Indices>
+        constexpr bool is_initializable_from(std::index_sequence<Indices...>)
+        {
+            return requires { Record{ ((void)Indices, any_field{})... }; };
+        }
+
+        template <typename Record, std::size_t N = 0>
+        constexpr std::size_t aggregate_arity()
+        {
+            if constexpr (N < 12 && is_initializable_from<Record>(std::make_index_sequence<N + 1>{}))
+                return aggregate_arity<Record, N + 1>();
+            else
+                return N;
+        }
+
+        template <typename Record>
+        concept has_record_fields = requires { typename record_fields<std::remove_const_t<Record>>::type; };
+
+        template <typename Record, typename Function, auto... Members>
+        constexpr decltype(auto) apply_members(Record& aRecord, Function&& aFunction, fields<Members...>)
+        {
+            return aFunction(aRecord.*Members...);
+        }
+
+        /// Calls aFunction with (references to) the fields of aRecord in declaration order.
+        template <typename Record, typename Function>
+        constexpr decltype(auto) apply_fields(Record& aRecord, Function&& aFunction)
+        {
+            if constexpr (has_record_fields<Record>)
+                return apply_members(aRecord, aFunction, typename record_fields<std::remove_const_t<Record>>::type{});
+            else
+            {
+                constexpr std::size_t arity = aggregate_arity<std::remove_const_t<Record>>();
+                static_assert(arity >= 1 && arity <= 12, "neounit::apply_fields: specialize neounit::record_fields for this record");
+                if constexpr (arity == 1)
+                {
+                    auto& [f1] = aRecord;
+                    return aFunction(f1);
+                }
+                else if constexpr (arity == 2)
+                {
+                    auto& [f1, f2] = aRecord;
+                    return aFunction(f1, f2);
+                }
+                else if constexpr (arity == 3)
+                {
+                    auto& [f1, f2, f3] = aRecord;
+                    return aFunction(f1, f2, f3);
+                }
+                else if constexpr (arity == 4)
+                {
+                    auto& [f1, f2, f3, f4] = aRecord;
+                    return aFunction(f1, f2, f3, f4);
+                }
+                else if constexpr (arity == 5)
+                {
+                    auto& [f1, f2, f3, f4, f5] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5);
+                }
+                else if constexpr (arity == 6)
+                {
+                    auto& [f1, f2, f3, f4, f5, f6] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5, f6);
+                }
+                else if constexpr (arity == 7)
+                {
+                    auto& [f1, f2, f3, f4, f5, f6, f7] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5, f6, f7);
+                }
+                else if constexpr (arity == 8)
+                {
+                    auto& [f1, f2, f3, f4, f5, f6, f7, f8] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5, f6, f7, f8);
+                }
+                else if constexpr (arity == 9)
+                {
+                    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5, f6, f7, f8, f9);
+                }
+                else if constexpr (arity == 10)
+                {
+                    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+                }
+                else if constexpr (arity == 11)
+                {
+                    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+                }
+                else
+                {
+                    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = aRecord;
+                    return aFunction(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+                }
+            }
+        }
+
+        template <typename To, typename From>
+        constexpr To convert_field(From const& aFrom)
+        {
+            if constexpr (std::is_same_v<To, From>)
+                return aFrom;
+            else if constexpr (is_scalar_quantity_v<To> && is_scalar_quantity_v<From>)
+                return conversion_cast<To>(aFrom);
+            else
+                return static_cast<To>(aFrom);
+        }
+    }
+
+    template <typename Target, typename Source>
+    constexpr Target convert_record(Source const& aSource)
+    {
+        Target result{};
+        detail::apply_fields(aSource, [&](auto const&... aSourceFields)
+        {
+            detail::apply_fields(result, [&](auto&... aTargetFields)
+            {
+                static_assert(sizeof...(aSourceFields) == sizeof...(aTargetFields), "neounit::convert_record: records have different numbers of fields");
+                ((aTargetFields = detail::convert_field<std::remove_cvref_t<decltype(aTargetFields)>>(aSourceFields)), ...);
+            });
+        });
+        return result;
+    }
+
+    /// Converts every record of aSource into the corresponding record of aTarget in a single pass.
+    template <typename Source, std::size_t SourceExtent, typename Target, std::size_t TargetExtent>
+    inline void convert_records(std::span<Source, SourceExtent> aSource, std::span<Target, TargetExtent> aTarget)
+    {
+        if (aTarget.size() < aSource.size())
+            throw std::invalid_argument("neounit::convert_records: target too small");
+        auto const source = aSource.data();
+        auto const target = aTarget.data();
+        for (std::size_t i = 0; i < aSource.size(); ++i)
+            target[i] = convert_record<std::remove_const_t<Target>>(source[i]);
+    }
+}
@@ -52,6 +52,8 @@ namespace neounit::si
         AbsoluteTemperature = 4,
         AmountOfSubstance   = 5,
         LuminousIntensity   = 6,
+        PlaneAngle          = 7,
+        Information         = 8,
 
         T = Time,
         L = Length,
@@ -62,38 +64,57 @@ namespace neounit::si
         J = LuminousIntensity
     };
 
-    #define s_EXPONENTS(E) E, 0, 0, 0, 0, 0, 0
-    #define m_EXPONENTS(E) 0, E, 0, 0, 0, 0, 0
-    #define g_EXPONENTS(E) 0, 0, E, 0, 0, 0, 0
-    #define A_EXPONENTS(E) 0, 0, 0, E, 0, 0, 0
-    #define K_EXPONENTS(E) 0, 0, 0, 0, E, 0, 0
-    #define mol_EXPONENTS(E) 0, 0, 0, 0, 0, E, 0
-    #define cd_EXPONENTS(E) 0, 0, 0, 0, 0, 0, E
+    #define s_EXPONENTS(E) E, 0, 0, 0, 0, 0, 0, 0, 0
+    #define m_EXPONENTS(E) 0, E, 0, 0, 0, 0, 0, 0, 0
+    #define g_EXPONENTS(E) 0, 0, E, 0, 0, 0, 0, 0, 0
+    #define A_EXPONENTS(E) 0, 0, 0, E, 0, 0, 0, 0, 0
+    #define K_EXPONENTS(E) 0, 0, 0, 0, E, 0, 0, 0, 0
+    #define mol_EXPONENTS(E) 0, 0, 0, 0, 0, E, 0, 0, 0
+    #define cd_EXPONENTS(E) 0, 0, 0, 0, 0, 0, E, 0, 0
+    #define rad_EXPONENTS(E) 0, 0, 0, 0, 0, 0, 0, E, 0
+    #define B_EXPONENTS(E) 0, 0, 0, 0, 0, 0, 0, 0, E
 
     template<dimensional_exponent E, typename T = double>
-    using s = scalar<T, dimension, exponents<s_EXPONENTS(E)>, typename ratios<one, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(E)>>;
+    using s = scalar<T, dimension, exponents<s_EXPONENTS(E)>, typename ratios<one, none, none, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using m = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, one, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
+    using m = scalar<T, dimension, exponents<m_EXPONENTS(E)>, typename ratios<none, one, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using g = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, one, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
+    using g = scalar<T, dimension, exponents<g_EXPONENTS(E)>, typename ratios<none, none, one, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using A = scalar<T, dimension, exponents<A_EXPONENTS(E)>, typename ratios<none, none, none, one, none, none, none>::apply_power_sign_t<A_EXPONENTS(E)>>;
+    using A = scalar<T, dimension, exponents<A_EXPONENTS(E)>, typename ratios<none, none, none, one, none, none, none, none, none>::apply_power_sign_t<A_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using K = scalar<T, dimension, exponents<K_EXPONENTS(E)>, typename ratios<none, none, none, none, one, none, none>::apply_power_sign_t<K_EXPONENTS(E)>>;
+    using K = scalar<T, dimension, exponents<K_EXPONENTS(E)>, typename ratios<none, none, none, none, one, none, none, none, none>::apply_power_sign_t<K_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using mol = scalar<T, dimension, exponents<mol_EXPONENTS(E)>, typename ratios<none, none, none, none, none, one, none>::apply_power_sign_t<mol_EXPONENTS(E)>>;
+    using mol = scalar<T, dimension, exponents<mol_EXPONENTS(E)>, typename ratios<none, none, none, none, none, one, none, none, none>::apply_power_sign_t<mol_EXPONENTS(E)>>;
     template<dimensional_exponent E, typename T = double>
-    using cd = scalar<T, dimension, exponents<cd_EXPONENTS(E)>, typename ratios<none, none, none, none, none, none, one>::apply_power_sign_t<cd_EXPONENTS(E)>>;
+    using cd = scalar<T, dimension, exponents<cd_EXPONENTS(E)>, typename ratios<none, none, none, none, none, none, one, none, none>::apply_power_sign_t<cd_EXPONENTS(E)>>;
 
     namespace literals
     {
-        inline auto operator "" _s(long double n) { return scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<one, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _m(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _g(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, one, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _A(long double n) { return scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _K(long double n) { return scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, one, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _mol(long double n) { return scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, one, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _cd(long double n) { return scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, one>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _s(long double n) { return scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<one, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _s(unsigned long long n) { return scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<one, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _m(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, one, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _m(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, one, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _g(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, one, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _g(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, one, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _A(long double n) { return scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _A(unsigned long long n) { return scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _K(long double n) { return scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, one, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _K(unsigned long long n) { return scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, one, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _mol(long double n) { return scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, one, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _mol(unsigned long long n) { return scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, one, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _cd(long double n) { return scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, one, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _cd(unsigned long long n) { return scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, one, none, none>>{ static_cast<double>(n) }; }
+        namespace exact
+        {
+            template <char... Chars> consteval auto operator "" _s() { return make_exact_literal<scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<one, none, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _m() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, one, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _g() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, one, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _A() { return make_exact_literal<scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _K() { return make_exact_literal<scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, one, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _mol() { return make_exact_literal<scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, one, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _cd() { return make_exact_literal<scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, one, none, none>>, Chars...>(); }
+        }
     }
 
     using s_sq = s<2>;
@@ -164,6 +185,8 @@ namespace neounit::si
     template <> struct dimension_as_string<dimension::AbsoluteTemperature> { static constexpr std::string_view string = "K"; };
     template <> struct dimension_as_string<dimension::AmountOfSubstance> { static constexpr std::string_view string = "mol"; };
     template <> struct dimension_as_string<dimension::LuminousIntensity> { static constexpr std::string_view string = "cd"; };
+    template <> struct dimension_as_string<dimension::PlaneAngle> { static constexpr std::string_view string = "rad"; };
+    template <> struct dimension_as_string<dimension::Information> { static constexpr std::string_view string = "B"; };
 
     template <dimension D>
     struct dimension_as_u8string { static constexpr std::u8string_view string = u8""; };
@@ -174,6 +197,8 @@ namespace neounit::si
     template <> struct dimension_as_u8string<dimension::AbsoluteTemperature> { static constexpr std::u8string_view string = u8"K"; };
     template <> struct dimension_as_u8string<dimension::AmountOfSubstance> { static constexpr std::u8string_view string = u8"mol"; };
     template <> struct dimension_as_u8string<dimension::LuminousIntensity> { static constexpr std::u8string_view string = u8"cd"; };
+    template <> struct dimension_as_u8string<dimension::PlaneAngle> { static constexpr std::u8string_view string = u8"rad"; };
+    template <> struct dimension_as_u8string<dimension::Information> { static constexpr std::u8string_view string = u8"B"; };
 
     template <dimension D, dimensional_exponent E, typename Ratio>
     struct base_unit_pre_exponent_to_string
@@ -227,13 +252,15 @@ namespace neounit::si
         template <> struct unit_position_t<as_integer_v<dimension::AbsoluteTemperature>> { static constexpr std::size_t position = 4u; };
         template <> struct unit_position_t<as_integer_v<dimension::AmountOfSubstance>> { static constexpr std::size_t position = 5u; };
         template <> struct unit_position_t<as_integer_v<dimension::LuminousIntensity>> { static constexpr std::size_t position = 6u; };
+        template <> struct unit_position_t<as_integer_v<dimension::PlaneAngle>> { static constexpr std::size_t position = 7u; };
+        template <> struct unit_position_t<as_integer_v<dimension::Information>> { static constexpr std::size_t position = 8u; };
         template <std::size_t I>
         constexpr std::size_t unit_position_v = unit_position_t<I>::position;
 
         template <dimensional_exponent... Exponent, typename... Ratio, std::size_t... Is>
         inline std::string base_units_to_string(unit<dimension, exponents<Exponent...>, ratios<Ratio...>> const&, std::index_sequence<Is...>)
         {
-            thread_local std::array<std::string, 7> tPartialResult;
+            thread_local std::array<std::string, 9> tPartialResult;
             ((tPartialResult[unit_position_v<Is>] = si::base_unit_to_string<as_dimension_v<Is>, Exponent, Ratio>()), ...);
             thread_local std::string result;
             result.clear();
@@ -251,7 +278,7 @@ namespace neounit::si
         template <dimensional_exponent... Exponent, typename... Ratio, std::size_t... Is>
         inline std::u8string base_units_to_u8string(unit<dimension, exponents<Exponent...>, ratios<Ratio...>> const&, std::index_sequence<Is...>)
         {
-            thread_local std::array<std::u8string, 7> tPartialResult;
+            thread_local std::array<std::u8string, 9> tPartialResult;
             ((tPartialResult[unit_position_v<Is>] = si::base_unit_to_u8string<as_dimension_v<Is>, Exponent, Ratio>()), ...);
             thread_local std::u8string result;
             result.clear();
@@ -281,77 +308,94 @@ namespace neounit::si
 
     #define define_si_prefix(ShortPrefix, Ratio)\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## s = scalar<T, dimension, exponents<s_EXPONENTS(E)>, ratios<Ratio, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(E)>>;\
+    using ShortPrefix ## s = scalar<T, dimension, exponents<s_EXPONENTS(E)>, ratios<Ratio, none, none, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## m = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, Ratio, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
+    using ShortPrefix ## m = scalar<T, dimension, exponents<m_EXPONENTS(E)>, ratios<none, Ratio, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## g = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, Ratio, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
+    using ShortPrefix ## g = scalar<T, dimension, exponents<g_EXPONENTS(E)>, ratios<none, none, Ratio, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## A = scalar<T, dimension, exponents<A_EXPONENTS(E)>, ratios<none, none, none, Ratio, none, none, none>::apply_power_sign_t<A_EXPONENTS(E)>>;\
+    using ShortPrefix ## A = scalar<T, dimension, exponents<A_EXPONENTS(E)>, ratios<none, none, none, Ratio, none, none, none, none, none>::apply_power_sign_t<A_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## K = scalar<T, dimension, exponents<K_EXPONENTS(E)>, ratios<none, none, none, none, Ratio, none, none>::apply_power_sign_t<K_EXPONENTS(E)>>;\
+    using ShortPrefix ## K = scalar<T, dimension, exponents<K_EXPONENTS(E)>, ratios<none, none, none, none, Ratio, none, none, none, none>::apply_power_sign_t<K_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## mol = scalar<T, dimension, exponents<mol_EXPONENTS(E)>, ratios<none, none, none, none, none, Ratio, none>::apply_power_sign_t<mol_EXPONENTS(E)>>;\
+    using ShortPrefix ## mol = scalar<T, dimension, exponents<mol_EXPONENTS(E)>, ratios<none, none, none, none, none, Ratio, none, none, none>::apply_power_sign_t<mol_EXPONENTS(E)>>;\
     template<dimensional_exponent E, typename T = double>\
-    using ShortPrefix ## cd = scalar<T, dimension, exponents<cd_EXPONENTS(E)>, ratios<none, none, none, none, none, none, Ratio>::apply_power_sign_t<cd_EXPONENTS(E)>>;\
-    using ShortPrefix ## s_sq = scalar<double, dimension, exponents<s_EXPONENTS(2)>, ratios<Ratio, none, none, none, none, none, none>>;\
-    using ShortPrefix ## m_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, Ratio, none, none, none, none, none>>;\
-    using ShortPrefix ## g_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, Ratio, none, none, none, none>>;\
-    using ShortPrefix ## A_sq = scalar<double, dimension, exponents<A_EXPONENTS(2)>, ratios<none, none, none, Ratio, none, none, none>>;\
-    using ShortPrefix ## K_sq = scalar<double, dimension, exponents<K_EXPONENTS(2)>, ratios<none, none, none, none, Ratio, none, none>>;\
-    using ShortPrefix ## mol_sq = scalar<double, dimension, exponents<mol_EXPONENTS(2)>, ratios<none, none, none, none, none, Ratio, none>>;\
-    using ShortPrefix ## cd_sq = scalar<double, dimension, exponents<cd_EXPONENTS(2)>, ratios<none, none, none, none, none, none, Ratio>>;\
-    using inv_ ## ShortPrefix ## s = scalar<double, dimension, exponents<s_EXPONENTS(-1)>, ratios<Ratio, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## m = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, Ratio, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## g = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, Ratio, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## A = scalar<double, dimension, exponents<A_EXPONENTS(-1)>, ratios<none, none, none, Ratio, none, none, none>::apply_power_sign_t<A_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## K = scalar<double, dimension, exponents<K_EXPONENTS(-1)>, ratios<none, none, none, none, Ratio, none, none>::apply_power_sign_t<K_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## mol = scalar<double, dimension, exponents<mol_EXPONENTS(-1)>, ratios<none, none, none, none, none, Ratio, none>::apply_power_sign_t<mol_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## cd = scalar<double, dimension, exponents<cd_EXPONENTS(-1)>, ratios<none, none, none, none, none, none, Ratio>::apply_power_sign_t<cd_EXPONENTS(-1)>>;\
-    using inv_ ## ShortPrefix ## s_sq = scalar<double, dimension, exponents<s_EXPONENTS(-2)>, ratios<Ratio, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## m_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, Ratio, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## g_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, Ratio, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## A_sq = scalar<double, dimension, exponents<A_EXPONENTS(-2)>, ratios<none, none, none, Ratio, none, none, none>::apply_power_sign_t<A_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## K_sq = scalar<double, dimension, exponents<K_EXPONENTS(-2)>, ratios<none, none, none, none, Ratio, none, none>::apply_power_sign_t<K_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## mol_sq = scalar<double, dimension, exponents<mol_EXPONENTS(-2)>, ratios<none, none, none, none, none, Ratio, none>::apply_power_sign_t<mol_EXPONENTS(-2)>>;\
-    using inv_ ## ShortPrefix ## cd_sq = scalar<double, dimension, exponents<cd_EXPONENTS(-2)>, ratios<none, none, none, none, none, none, Ratio>::apply_power_sign_t<cd_EXPONENTS(-2)>>;\
-    using Ratio ## second = scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<Ratio, none, none, none, none, none, none>>;\
-    using Ratio ## metre = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, Ratio, none, none, none, none, none>>;\
-    using Ratio ## gram = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, Ratio, none, none, none, none>>;\
-    using Ratio ## ampere = scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, Ratio, none, none, none>>;\
-    using Ratio ## kelvin = scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, Ratio, none, none>>;\
-    using Ratio ## mole = scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, Ratio, none>>;\
-    using Ratio ## candela = scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, Ratio>>;\
-    using Ratio ## second_sq = scalar<double, dimension, exponents<s_EXPONENTS(2)>, ratios<Ratio, none, none, none, none, none, none>>;\
-    using Ratio ## metre_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, Ratio, none, none, none, none, none>>;\
-    using Ratio ## gram_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, Ratio, none, none, none, none>>;\
-    using Ratio ## ampere_sq = scalar<double, dimension, exponents<A_EXPONENTS(2)>, ratios<none, none, none, Ratio, none, none, none>>;\
-    using Ratio ## kelvin_sq = scalar<double, dimension, exponents<K_EXPONENTS(2)>, ratios<none, none, none, none, Ratio, none, none>>;\
-    using Ratio ## mole_sq = scalar<double, dimension, exponents<mol_EXPONENTS(2)>, ratios<none, none, none, none, none, Ratio, none>>;\
-    using Ratio ## candela_sq = scalar<double, dimension, exponents<cd_EXPONENTS(2)>, ratios<none, none, none, none, none, none, Ratio>>;\
-    using inv_ ## Ratio ## second = scalar<double, dimension, exponents<s_EXPONENTS(-1)>, ratios<Ratio, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## metre = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, Ratio, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## gram = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, Ratio, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## ampere = scalar<double, dimension, exponents<A_EXPONENTS(-1)>, ratios<none, none, none, Ratio, none, none, none>::apply_power_sign_t<A_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## kelvin = scalar<double, dimension, exponents<K_EXPONENTS(-1)>, ratios<none, none, none, none, Ratio, none, none>::apply_power_sign_t<K_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## mole = scalar<double, dimension, exponents<mol_EXPONENTS(-1)>, ratios<none, none, none, none, none, Ratio, none>::apply_power_sign_t<mol_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## candela = scalar<double, dimension, exponents<cd_EXPONENTS(-1)>, ratios<none, none, none, none, none, none, Ratio>::apply_power_sign_t<cd_EXPONENTS(-1)>>;\
-    using inv_ ## Ratio ## second_sq = scalar<double, dimension, exponents<s_EXPONENTS(-2)>, ratios<Ratio, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-2)>>;\
-    using inv_ ## Ratio ## metre_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, Ratio, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
-    using inv_ ## Ratio ## gram_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, Ratio, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-2)>>;\
-    using inv_ ## Ratio ## ampere_sq = scalar<double, dimension, exponents<A_EXPONENTS(-2)>, ratios<none, none, none, Ratio, none, none, none>::apply_power_sign_t<A_EXPONENTS(-2)>>;\
-    using inv_ ## Ratio ## kelvin_sq = scalar<double, dimension, exponents<K_EXPONENTS(-2)>, ratios<none, none, none, none, Ratio, none, none>::apply_power_sign_t<K_EXPONENTS(-2)>>;\
-    using inv_ ## Ratio ## mole_sq = scalar<double, dimension, exponents<mol_EXPONENTS(-2)>, ratios<none, none, none, none, none, Ratio, none>::apply_power_sign_t<mol_EXPONENTS(-2)>>;\
-    using inv_ ## Ratio ## candela_sq = scalar<double, dimension, exponents<cd_EXPONENTS(-2)>, ratios<none, none, none, none, none, none, Ratio>::apply_power_sign_t<cd_EXPONENTS(-2)>>;\
+    using ShortPrefix ## cd = scalar<T, dimension, exponents<cd_EXPONENTS(E)>, ratios<none, none, none, none, none, none, Ratio, none, none>::apply_power_sign_t<cd_EXPONENTS(E)>>;\
+    using ShortPrefix ## s_sq = scalar<double, dimension, exponents<s_EXPONENTS(2)>, ratios<Ratio, none, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## m_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, Ratio, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## g_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, Ratio, none, none, none, none, none, none>>;\
+    using ShortPrefix ## A_sq = scalar<double, dimension, exponents<A_EXPONENTS(2)>, ratios<none, none, none, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## K_sq = scalar<double, dimension, exponents<K_EXPONENTS(2)>, ratios<none, none, none, none, Ratio, none, none, none, none>>;\
+    using ShortPrefix ## mol_sq = scalar<double, dimension, exponents<mol_EXPONENTS(2)>, ratios<none, none, none, none, none, Ratio, none, none, none>>;\
+    using ShortPrefix ## cd_sq = scalar<double, dimension, exponents<cd_EXPONENTS(2)>, ratios<none, none, none, none, none, none, Ratio, none, none>>;\
+    using inv_ ## ShortPrefix ## s = scalar<double, dimension, exponents<s_EXPONENTS(-1)>, ratios<Ratio, none, none, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## m = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, Ratio, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## g = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, Ratio, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## A = scalar<double, dimension, exponents<A_EXPONENTS(-1)>, ratios<none, none, none, Ratio, none, none, none, none, none>::apply_power_sign_t<A_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## K = scalar<double, dimension, exponents<K_EXPONENTS(-1)>, ratios<none, none, none, none, Ratio, none, none, none, none>::apply_power_sign_t<K_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## mol = scalar<double, dimension, exponents<mol_EXPONENTS(-1)>, ratios<none, none, none, none, none, Ratio, none, none, none>::apply_power_sign_t<mol_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## cd = scalar<double, dimension, exponents<cd_EXPONENTS(-1)>, ratios<none, none, none, none, none, none, Ratio, none, none>::apply_power_sign_t<cd_EXPONENTS(-1)>>;\
+    using inv_ ## ShortPrefix ## s_sq = scalar<double, dimension, exponents<s_EXPONENTS(-2)>, ratios<Ratio, none, none, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## m_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, Ratio, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## g_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, Ratio, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## A_sq = scalar<double, dimension, exponents<A_EXPONENTS(-2)>, ratios<none, none, none, Ratio, none, none, none, none, none>::apply_power_sign_t<A_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## K_sq = scalar<double, dimension, exponents<K_EXPONENTS(-2)>, ratios<none, none, none, none, Ratio, none, none, none, none>::apply_power_sign_t<K_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## mol_sq = scalar<double, dimension, exponents<mol_EXPONENTS(-2)>, ratios<none, none, none, none, none, Ratio, none, none, none>::apply_power_sign_t<mol_EXPONENTS(-2)>>;\
+    using inv_ ## ShortPrefix ## cd_sq = scalar<double, dimension, exponents<cd_EXPONENTS(-2)>, ratios<none, none, none, none, none, none, Ratio, none, none>::apply_power_sign_t<cd_EXPONENTS(-2)>>;\
+    using Ratio ## second = scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<Ratio, none, none, none, none, none, none, none, none>>;\
+    using Ratio ## metre = scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, Ratio, none, none, none, none, none, none, none>>;\
+    using Ratio ## gram = scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, Ratio, none, none, none, none, none, none>>;\
+    using Ratio ## ampere = scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, Ratio, none, none, none, none, none>>;\
+    using Ratio ## kelvin = scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, Ratio, none, none, none, none>>;\
+    using Ratio ## mole = scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, Ratio, none, none, none>>;\
+    using Ratio ## candela = scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, Ratio, none, none>>;\
+    using Ratio ## second_sq = scalar<double, dimension, exponents<s_EXPONENTS(2)>, ratios<Ratio, none, none, none, none, none, none, none, none>>;\
+    using Ratio ## metre_sq = scalar<double, dimension, exponents<m_EXPONENTS(2)>, ratios<none, Ratio, none, none, none, none, none, none, none>>;\
+    using Ratio ## gram_sq = scalar<double, dimension, exponents<g_EXPONENTS(2)>, ratios<none, none, Ratio, none, none, none, none, none, none>>;\
+    using Ratio ## ampere_sq = scalar<double, dimension, exponents<A_EXPONENTS(2)>, ratios<none, none, none, Ratio, none, none, none, none, none>>;\
+    using Ratio ## kelvin_sq = scalar<double, dimension, exponents<K_EXPONENTS(2)>, ratios<none, none, none, none, Ratio, none, none, none, none>>;\
+    using Ratio ## mole_sq = scalar<double, dimension, exponents<mol_EXPONENTS(2)>, ratios<none, none, none, none, none, Ratio, none, none, none>>;\
+    using Ratio ## candela_sq = scalar<double, dimension, exponents<cd_EXPONENTS(2)>, ratios<none, none, none, none, none, none, Ratio, none, none>>;\
+    using inv_ ## Ratio ## second = scalar<double, dimension, exponents<s_EXPONENTS(-1)>, ratios<Ratio, none, none, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## metre = scalar<double, dimension, exponents<m_EXPONENTS(-1)>, ratios<none, Ratio, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## gram = scalar<double, dimension, exponents<g_EXPONENTS(-1)>, ratios<none, none, Ratio, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## ampere = scalar<double, dimension, exponents<A_EXPONENTS(-1)>, ratios<none, none, none, Ratio, none, none, none, none, none>::apply_power_sign_t<A_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## kelvin = scalar<double, dimension, exponents<K_EXPONENTS(-1)>, ratios<none, none, none, none, Ratio, none, none, none, none>::apply_power_sign_t<K_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## mole = scalar<double, dimension, exponents<mol_EXPONENTS(-1)>, ratios<none, none, none, none, none, Ratio, none, none, none>::apply_power_sign_t<mol_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## candela = scalar<double, dimension, exponents<cd_EXPONENTS(-1)>, ratios<none, none, none, none, none, none, Ratio, none, none>::apply_power_sign_t<cd_EXPONENTS(-1)>>;\
+    using inv_ ## Ratio ## second_sq = scalar<double, dimension, exponents<s_EXPONENTS(-2)>, ratios<Ratio, none, none, none, none, none, none, none, none>::apply_power_sign_t<s_EXPONENTS(-2)>>;\
+    using inv_ ## Ratio ## metre_sq = scalar<double, dimension, exponents<m_EXPONENTS(-2)>, ratios<none, Ratio, none, none, none, none, none, none, none>::apply_power_sign_t<m_EXPONENTS(-2)>>;\
+    using inv_ ## Ratio ## gram_sq = scalar<double, dimension, exponents<g_EXPONENTS(-2)>, ratios<none, none, Ratio, none, none, none, none, none, none>::apply_power_sign_t<g_EXPONENTS(-2)>>;\
+    using inv_ ## Ratio ## ampere_sq = scalar<double, dimension, exponents<A_EXPONENTS(-2)>, ratios<none, none, none, Ratio, none, none, none, none, none>::apply_power_sign_t<A_EXPONENTS(-2)>>;\
+    using inv_ ## Ratio ## kelvin_sq = scalar<double, dimension, exponents<K_EXPONENTS(-2)>, ratios<none, none, none, none, Ratio, none, none, none, none>::apply_power_sign_t<K_EXPONENTS(-2)>>;\
+    using inv_ ## Ratio ## mole_sq = scalar<double, dimension, exponents<mol_EXPONENTS(-2)>, ratios<none, none, none, none, none, Ratio, none, none, none>::apply_power_sign_t<mol_EXPONENTS(-2)>>;\
+    using inv_ ## Ratio ## candela_sq = scalar<double, dimension, exponents<cd_EXPONENTS(-2)>, ratios<none, none, none, none, none, none, Ratio, none, none>::apply_power_sign_t<cd_EXPONENTS(-2)>>;\
     namespace literals\
     {\
-        inline auto operator "" _ ## ShortPrefix ## s(long double n) { return scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<Ratio, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## m(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## g(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, Ratio, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## A(long double n) { return scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## K(long double n) { return scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, Ratio, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## mol(long double n) { return scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, Ratio, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## cd(long double n) { return scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, Ratio>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## s(long double n) { return scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<Ratio, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## s(unsigned long long n) { return scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<Ratio, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## m(long double n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, Ratio, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## m(unsigned long long n) { return scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, Ratio, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## g(long double n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, Ratio, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## g(unsigned long long n) { return scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, Ratio, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## A(long double n) { return scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## A(unsigned long long n) { return scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## K(long double n) { return scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, Ratio, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## K(unsigned long long n) { return scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, Ratio, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## mol(long double n) { return scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## mol(unsigned long long n) { return scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## cd(long double n) { return scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, Ratio, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## cd(unsigned long long n) { return scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, Ratio, none, none>>{ static_cast<double>(n) }; }\
+        namespace exact\
+        {\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## s() { return make_exact_literal<scalar<double, dimension, exponents<s_EXPONENTS(1)>, ratios<Ratio, none, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## m() { return make_exact_literal<scalar<double, dimension, exponents<m_EXPONENTS(1)>, ratios<none, Ratio, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## g() { return make_exact_literal<scalar<double, dimension, exponents<g_EXPONENTS(1)>, ratios<none, none, Ratio, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## A() { return make_exact_literal<scalar<double, dimension, exponents<A_EXPONENTS(1)>, ratios<none, none, none, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## K() { return make_exact_literal<scalar<double, dimension, exponents<K_EXPONENTS(1)>, ratios<none, none, none, none, Ratio, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## mol() { return make_exact_literal<scalar<double, dimension, exponents<mol_EXPONENTS(1)>, ratios<none, none, none, none, none, Ratio, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## cd() { return make_exact_literal<scalar<double, dimension, exponents<cd_EXPONENTS(1)>, ratios<none, none, none, none, none, none, Ratio, none, none>>, Chars...>(); }\
+        }\
     }\
 
     define_si_prefix(q, quecto)
@@ -43,80 +43,81 @@
 
 namespace neounit::si
 {
-    // s m g A K mol cd
+    // s m g A K mol cd rad B
 
-    #define Hz_EXPONENTS -1, 0, 0, 0, 0, 0, 0
-    #define N_EXPONENTS -2, 1, 1, 0, 0, 0, 0
-    #define Pa_EXPONENTS -2, -1, 1, 0, 0, 0, 0
-    #define J_EXPONENTS -2, 2, 1, 0, 0, 0, 0
-    #define W_EXPONENTS -3, 2, 1, 0, 0, 0, 0
-    #define C_EXPONENTS 1, 0, 0, 1, 0, 0, 0
-    #define V_EXPONENTS -3, 2, 1, -1, 0, 0, 0
-    #define F_EXPONENTS 4, -2, -1, 2, 0, 0, 0
-    #define Ω_EXPONENTS -3, 2, 1, -2, 0, 0, 0
-    #define S_EXPONENTS 3, -2, -1, 2, 0, 0, 0
-    #define Wb_EXPONENTS -2, 2, 1, -1, 0, 0, 0
-    #define T_EXPONENTS -2, 0, 1, -1, 0, 0, 0
-    #define H_EXPONENTS -2, 2, 1, -2, 0, 0, 0
-    #define degC_EXPONENTS 0, 0, 0, 0, 1, 0, 0
-    #define lm_EXPONENTS 0, 0, 0, 0, 0, 0, 1
-    #define lx_EXPONENTS 0, -2, 0, 0, 0, 0, 1
-    #define Bq_EXPONENTS -1, 0, 0, 0, 0, 0, 0
-    #define Gy_EXPONENTS -2, 2, 0, 0, 0, 0, 0
-    #define Sv_EXPONENTS -2, 2, 0, 0, 0, 0, 0
-    #define kat_EXPONENTS -1, 0, 0, 0, 0, 1, 0
+    #define Hz_EXPONENTS -1, 0, 0, 0, 0, 0, 0, 0, 0
+    #define sr_EXPONENTS 0, 0, 0, 0, 0, 0, 0, 2, 0
+    #define N_EXPONENTS -2, 1, 1, 0, 0, 0, 0, 0, 0
+    #define Pa_EXPONENTS -2, -1, 1, 0, 0, 0, 0, 0, 0
+    #define J_EXPONENTS -2, 2, 1, 0, 0, 0, 0, 0, 0
+    #define W_EXPONENTS -3, 2, 1, 0, 0, 0, 0, 0, 0
+    #define C_EXPONENTS 1, 0, 0, 1, 0, 0, 0, 0, 0
+    #define V_EXPONENTS -3, 2, 1, -1, 0, 0, 0, 0, 0
+    #define F_EXPONENTS 4, -2, -1, 2, 0, 0, 0, 0, 0
+    #define Ω_EXPONENTS -3, 2, 1, -2, 0, 0, 0, 0, 0
+    #define S_EXPONENTS 3, -2, -1, 2, 0, 0, 0, 0, 0
+    #define Wb_EXPONENTS -2, 2, 1, -1, 0, 0, 0, 0, 0
+    #define T_EXPONENTS -2, 0, 1, -1, 0, 0, 0, 0, 0
+    #define H_EXPONENTS -2, 2, 1, -2, 0, 0, 0, 0, 0
+    #define degC_EXPONENTS 0, 0, 0, 0, 1, 0, 0, 0, 0
+    #define lm_EXPONENTS 0, 0, 0, 0, 0, 0, 1, 2, 0
+    #define lx_EXPONENTS 0, -2, 0, 0, 0, 0, 1, 2, 0
+    #define Bq_EXPONENTS -1, 0, 0, 0, 0, 0, 0, 0, 0
+    #define Gy_EXPONENTS -2, 2, 0, 0, 0, 0, 0, 0, 0
+    #define Sv_EXPONENTS -2, 2, 0, 0, 0, 0, 0, 0, 0
+    #define kat_EXPONENTS -1, 0, 0, 0, 0, 1, 0, 0, 0
 
     template<typename T = double>
-    using Hz = scalar<T, dimension, exponents<Hz_EXPONENTS>, ratios<one, none, none, none, none, none, none>>;
+    using Hz = scalar<T, dimension, exponents<Hz_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>;
     template<typename T = double>
-    using rad = T;
+    using rad = scalar<T, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, one, none>>;
     template<typename T = double>
-    using sr = T;
+    using sr = scalar<T, dimension, exponents<sr_EXPONENTS>, ratios<none, none, none, none, none, none, none, one, none>>;
     template<typename T = double>
-    using N = scalar<T, dimension, exponents<N_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>;
+    using N = scalar<T, dimension, exponents<N_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>;
     template<typename T = double>
-    using Pa = scalar<T, dimension, exponents<Pa_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>;
+    using Pa = scalar<T, dimension, exponents<Pa_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>;
     template<typename T = double>
-    using J = scalar<T, dimension, exponents<J_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>;
+    using J = scalar<T, dimension, exponents<J_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>;
     template<typename T = double>
-    using W = scalar<T, dimension, exponents<W_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>;
+    using W = scalar<T, dimension, exponents<W_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>;
     template<typename T = double>
-    using C = scalar<T, dimension, exponents<C_EXPONENTS>, ratios<one, none, none, one, none, none, none>>;
+    using C = scalar<T, dimension, exponents<C_EXPONENTS>, ratios<one, none, none, one, none, none, none, none, none>>;
     template<typename T = double>
-    using V = scalar<T, dimension, exponents<V_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>;
+    using V = scalar<T, dimension, exponents<V_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>;
     template<typename T = double>
-    using F = scalar<T, dimension, exponents<F_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>;
+    using F = scalar<T, dimension, exponents<F_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>;
     template<typename T = double>
-    using Ω = scalar<T, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>;
+    using Ω = scalar<T, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>;
     template<typename T = double>
-    using S = scalar<T, dimension, exponents<S_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>;
+    using S = scalar<T, dimension, exponents<S_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>;
     template<typename T = double>
-    using Wb = scalar<T, dimension, exponents<Wb_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>;
+    using Wb = scalar<T, dimension, exponents<Wb_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>;
     template<typename T_ = double>
-    using T = scalar<T_, dimension, exponents<T_EXPONENTS>, ratios<one, none, kilo, one, none, none, none>>;
+    using T = scalar<T_, dimension, exponents<T_EXPONENTS>, ratios<one, none, kilo, one, none, none, none, none, none>>;
     template<typename T = double>
-    using H = scalar<T, dimension, exponents<H_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>;
+    using H = scalar<T, dimension, exponents<H_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>;
     template<typename T = double>
-    using degC = scalar<T, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, one, none, none>>;
+    using degC = scalar<T, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, one, none, none, none, none>>;
     template<typename T = double>
-    using lm = scalar<T, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, one>>;
+    using lm = scalar<T, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, one, one, none>>;
     template<typename T = double>
-    using lx = scalar<T, dimension, exponents<lx_EXPONENTS>, ratios<none, one, none, none, none, none, one>>;
+    using lx = scalar<T, dimension, exponents<lx_EXPONENTS>, ratios<none, one, none, none, none, none, one, one, none>>;
     template<typename T = double>
-    using Bq = scalar<T, dimension, exponents<Bq_EXPONENTS>, ratios<one, none, none, none, none, none, none>>;
+    using Bq = scalar<T, dimension, exponents<Bq_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>;
     template<typename T = double>
-    using Gy = scalar<T, dimension, exponents<Gy_EXPONENTS>, ratios<one, one, none, none, none, none, none>>;
+    using Gy = scalar<T, dimension, exponents<Gy_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>;
     template<typename T = double>
-    using Sv = scalar<T, dimension, exponents<Sv_EXPONENTS>, ratios<one, one, none, none, none, none, none>>;
+    using Sv = scalar<T, dimension, exponents<Sv_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>;
     template<typename T = double>
-    using kat = scalar<T, dimension, exponents<kat_EXPONENTS>, ratios<one, none, none, none, none, one, none>>;
+    using kat = scalar<T, dimension, exponents<kat_EXPONENTS>, ratios<one, none, none, none, none, one, none, none, none>>;
 
     template <std::size_t N, typename... Ts>
     using nth_type_of_t = typename std::tuple_element<N, std::tuple<Ts...>>::type;
     template <std::size_t N, typename Ratios>
     struct nth_ratio {};
     template <std::size_t N, typename... Ratios>
-    struct nth_ratio<N, ratios<Ratios...>> { using result_type = typename nth_type_of_t<N, Ratios...>; };
+    struct nth_ratio<N, ratios<Ratios...>> { using result_type = nth_type_of_t<N, Ratios...>; };
     template <int N, typename Ratios> using nth_ratio_t = typename nth_ratio<N, Ratios>::result_type;
 
     template <typename Unit> struct unit_key {};
@@ -127,6 +128,7 @@ namespace neounit::si
     template <typename Ratios, dimensional_exponent E> struct unit_key<unit<dimension, exponents<K_EXPONENTS(E)>, Ratios>> { static constexpr std::size_t key = 4; };
     template <typename Ratios, dimensional_exponent E> struct unit_key<unit<dimension, exponents<mol_EXPONENTS(E)>, Ratios>> { static constexpr std::size_t key = 5; };
     template <typename Ratios, dimensional_exponent E> struct unit_key<unit<dimension, exponents<cd_EXPONENTS(E)>, Ratios>> { static constexpr std::size_t key = 6; };
+    template <typename Ratios, dimensional_exponent E> struct unit_key<unit<dimension, exponents<rad_EXPONENTS(E)>, Ratios>> { static constexpr std::size_t key = 7; };
     template <typename Ratios> struct unit_key<unit<dimension, exponents<Hz_EXPONENTS>, Ratios>> { static constexpr std::size_t key = 0; };
     template <typename Ratios> struct unit_key<unit<dimension, exponents<N_EXPONENTS>, Ratios>> { static constexpr std::size_t key = 0; };
     template <typename Ratios> struct unit_key<unit<dimension, exponents<Pa_EXPONENTS>, Ratios>> { static constexpr std::size_t key = 0; };
@@ -175,29 +177,78 @@ namespace neounit::si
 
     namespace literals
     {
-        inline auto operator "" _Hz(long double n) { return scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<one, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _rad(long double n) { return static_cast<double>(n); }
-        inline auto operator "" _sr(long double n) { return static_cast<double>(n); }
-        inline auto operator "" _N(long double n) { return scalar<double, dimension, exponents<N_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _Pa(long double n) { return scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _J(long double n) { return scalar<double, dimension, exponents<J_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _W(long double n) { return scalar<double, dimension, exponents<W_EXPONENTS>, ratios<one, one, kilo, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _C(long double n) { return scalar<double, dimension, exponents<C_EXPONENTS>, ratios<one, none, none, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _V(long double n) { return scalar<double, dimension, exponents<V_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _F(long double n) { return scalar<double, dimension, exponents<F_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _Ω(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _ohm(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _S(long double n) { return scalar<double, dimension, exponents<S_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _Wb(long double n) { return scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _T(long double n) { return scalar<double, dimension, exponents<T_EXPONENTS>, ratios<one, none, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _H(long double n) { return scalar<double, dimension, exponents<H_EXPONENTS>, ratios<one, one, kilo, one, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _degC(long double n) { return scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, one, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _lm(long double n) { return scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, one>>{ static_cast<double>(n) }; }
-        inline auto operator "" _lx(long double n) { return scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, one, none, none, none, none, one>>{ static_cast<double>(n) }; }
-        inline auto operator "" _Bq(long double n) { return scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<one, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _Gy(long double n) { return scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<one, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _Sv(long double n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<one, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _kat(long double n) { return scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<one, none, none, none, none, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Hz(long double n) { return scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Hz(unsigned long long n) { return scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _rad(long double n) { return scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _rad(unsigned long long n) { return scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _sr(long double n) { return scalar<double, dimension, exponents<sr_EXPONENTS>, ratios<none, none, none, none, none, none, none, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _sr(unsigned long long n) { return scalar<double, dimension, exponents<sr_EXPONENTS>, ratios<none, none, none, none, none, none, none, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _N(long double n) { return scalar<double, dimension, exponents<N_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _N(unsigned long long n) { return scalar<double, dimension, exponents<N_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Pa(long double n) { return scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Pa(unsigned long long n) { return scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _J(long double n) { return scalar<double, dimension, exponents<J_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _J(unsigned long long n) { return scalar<double, dimension, exponents<J_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _W(long double n) { return scalar<double, dimension, exponents<W_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _W(unsigned long long n) { return scalar<double, dimension, exponents<W_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _C(long double n) { return scalar<double, dimension, exponents<C_EXPONENTS>, ratios<one, none, none, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _C(unsigned long long n) { return scalar<double, dimension, exponents<C_EXPONENTS>, ratios<one, none, none, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _V(long double n) { return scalar<double, dimension, exponents<V_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _V(unsigned long long n) { return scalar<double, dimension, exponents<V_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _F(long double n) { return scalar<double, dimension, exponents<F_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _F(unsigned long long n) { return scalar<double, dimension, exponents<F_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Ω(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Ω(unsigned long long n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _ohm(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _ohm(unsigned long long n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _S(long double n) { return scalar<double, dimension, exponents<S_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _S(unsigned long long n) { return scalar<double, dimension, exponents<S_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Wb(long double n) { return scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Wb(unsigned long long n) { return scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _T(long double n) { return scalar<double, dimension, exponents<T_EXPONENTS>, ratios<one, none, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _T(unsigned long long n) { return scalar<double, dimension, exponents<T_EXPONENTS>, ratios<one, none, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _H(long double n) { return scalar<double, dimension, exponents<H_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _H(unsigned long long n) { return scalar<double, dimension, exponents<H_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _degC(long double n) { return scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, one, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _degC(unsigned long long n) { return scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, one, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _lm(long double n) { return scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, one, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _lm(unsigned long long n) { return scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, one, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _lx(long double n) { return scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, one, none, none, none, none, one, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _lx(unsigned long long n) { return scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, one, none, none, none, none, one, one, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Bq(long double n) { return scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Bq(unsigned long long n) { return scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Gy(long double n) { return scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Gy(unsigned long long n) { return scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Sv(long double n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _Sv(unsigned long long n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _kat(long double n) { return scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<one, none, none, none, none, one, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _kat(unsigned long long n) { return scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<one, none, none, none, none, one, none, none, none>>{ static_cast<double>(n) }; }
+        namespace exact
+        {
+            template <char... Chars> consteval auto operator "" _Hz() { return make_exact_literal<scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _rad() { return make_exact_literal<scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, one, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _sr() { return make_exact_literal<scalar<double, dimension, exponents<sr_EXPONENTS>, ratios<none, none, none, none, none, none, none, one, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _N() { return make_exact_literal<scalar<double, dimension, exponents<N_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _Pa() { return make_exact_literal<scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _J() { return make_exact_literal<scalar<double, dimension, exponents<J_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _W() { return make_exact_literal<scalar<double, dimension, exponents<W_EXPONENTS>, ratios<one, one, kilo, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _C() { return make_exact_literal<scalar<double, dimension, exponents<C_EXPONENTS>, ratios<one, none, none, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _V() { return make_exact_literal<scalar<double, dimension, exponents<V_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _F() { return make_exact_literal<scalar<double, dimension, exponents<F_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _Ω() { return make_exact_literal<scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _ohm() { return make_exact_literal<scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _S() { return make_exact_literal<scalar<double, dimension, exponents<S_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _Wb() { return make_exact_literal<scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _T() { return make_exact_literal<scalar<double, dimension, exponents<T_EXPONENTS>, ratios<one, none, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _H() { return make_exact_literal<scalar<double, dimension, exponents<H_EXPONENTS>, ratios<one, one, kilo, one, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _degC() { return make_exact_literal<scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, one, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _lm() { return make_exact_literal<scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, one, one, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _lx() { return make_exact_literal<scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, one, none, none, none, none, one, one, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _Bq() { return make_exact_literal<scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<one, none, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _Gy() { return make_exact_literal<scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _Sv() { return make_exact_literal<scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<one, one, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _kat() { return make_exact_literal<scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<one, none, none, none, none, one, none, none, none>>, Chars...>(); }
+        }
     }
 
     using neounit::to_string;
@@ -212,7 +263,9 @@ namespace neounit::si
     /* (alias of degC) */ // template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<K_EXPONENTS(1)>, Ratios>> { static constexpr std::string_view string = dimension_as_string<dimension::AbsoluteTemperature>::string; };
     template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<mol_EXPONENTS(1)>, Ratios>> { static constexpr std::string_view string = dimension_as_string<dimension::AmountOfSubstance>::string; };
     /* (alias of lm) */ // template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<cd_EXPONENTS(1)>, Ratios>> { static constexpr std::string_view string = dimension_as_string<dimension::LuminousIntensity>::string; };
+    template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<rad_EXPONENTS(1)>, Ratios>> { static constexpr std::string_view string = dimension_as_string<dimension::PlaneAngle>::string; };
     template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<Hz_EXPONENTS>, Ratios>> { static constexpr std::string_view string = "Hz"; };
+    template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<sr_EXPONENTS>, Ratios>> { static constexpr std::string_view string = "sr"; };
     template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<N_EXPONENTS>, Ratios>> { static constexpr std::string_view string = "NX"; };
     template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<Pa_EXPONENTS>, Ratios>> { static constexpr std::string_view string = "Pa"; };
     template <typename Ratios> struct derived_unit_as_string<unit<dimension, exponents<J_EXPONENTS>, Ratios>> { static constexpr std::string_view string = "J"; };
@@ -242,7 +295,9 @@ namespace neounit::si
     /* (alias of degC) */ // template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<K_EXPONENTS(1)>, Ratios>> { static constexpr std::u8string_view string = dimension_as_u8string<dimension::AbsoluteTemperature>::string; };
     template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<mol_EXPONENTS(1)>, Ratios>> { static constexpr std::u8string_view string = dimension_as_u8string<dimension::AmountOfSubstance>::string; };
     /* (alias of lm) */ // template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<cd_EXPONENTS(1)>, Ratios>> { static constexpr std::u8string_view string = dimension_as_u8string<dimension::LuminousIntensity>::string; };
+    template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<rad_EXPONENTS(1)>, Ratios>> { static constexpr std::u8string_view string = dimension_as_u8string<dimension::PlaneAngle>::string; };
     template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<Hz_EXPONENTS>, Ratios>> { static constexpr std::u8string_view string = u8"Hz"; };
+    template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<sr_EXPONENTS>, Ratios>> { static constexpr std::u8string_view string = u8"sr"; };
     template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<N_EXPONENTS>, Ratios>> { static constexpr std::u8string_view string = u8"NX"; };
     template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<Pa_EXPONENTS>, Ratios>> { static constexpr std::u8string_view string = u8"Pa"; };
     template <typename Ratios> struct derived_unit_as_u8string<unit<dimension, exponents<J_EXPONENTS>, Ratios>> { static constexpr std::u8string_view string = u8"J"; };
@@ -288,69 +343,119 @@ namespace neounit::si
     }
 
     #define define_si_derived_prefix(ShortPrefix, Ratio)\
-    using ShortPrefix ## Hz = scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none>>;\
-    using ShortPrefix ## N = scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## Pa = scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## J = scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## W = scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using ShortPrefix ## C = scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none>>;\
-    using ShortPrefix ## V = scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using ShortPrefix ## F = scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using ShortPrefix ## Ω = scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using ShortPrefix ## S = scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using ShortPrefix ## Wb = scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using ShortPrefix ## T = scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using ShortPrefix ## H = scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using ShortPrefix ## degC = scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none>>;\
-    using ShortPrefix ## lm = scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio>>;\
-    using ShortPrefix ## lx = scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio>>;\
-    using ShortPrefix ## Bq = scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none>>;\
-    using ShortPrefix ## Gy = scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none>>;\
-    using ShortPrefix ## Sv = scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none>>;\
-    using ShortPrefix ## kat = scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none>>;\
-    using Ratio ## hertz = scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none>>;\
-    using Ratio ## newton = scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using Ratio ## pascal = scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using Ratio ## joule = scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using Ratio ## watt = scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>;\
-    using Ratio ## coulomb = scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none>>;\
-    using Ratio ## volt = scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using Ratio ## farad = scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using Ratio ## ohm = scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using Ratio ## siemens = scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using Ratio ## weber = scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using Ratio ## tesla = scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using Ratio ## henry = scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>;\
-    using Ratio ## Celsius = scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none>>;\
-    using Ratio ## lumen = scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio>>;\
-    using Ratio ## lux = scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio>>;\
-    using Ratio ## becquerel = scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none>>;\
-    using Ratio ## gray = scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none>>;\
-    using Ratio ## sievert = scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none>>;\
-    using Ratio ## katal = scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none>>;\
+    using ShortPrefix ## Hz = scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## rad = scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, Ratio, none>>;\
+    using ShortPrefix ## N = scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## Pa = scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## J = scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## W = scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using ShortPrefix ## C = scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## V = scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## F = scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## Ω = scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## S = scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## Wb = scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## T = scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## H = scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using ShortPrefix ## degC = scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none, none, none>>;\
+    using ShortPrefix ## lm = scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio, one, none>>;\
+    using ShortPrefix ## lx = scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio, one, none>>;\
+    using ShortPrefix ## Bq = scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## Gy = scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## Sv = scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## kat = scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none, none, none>>;\
+    using Ratio ## hertz = scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>;\
+    using Ratio ## radian = scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, Ratio, none>>;\
+    using Ratio ## newton = scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## pascal = scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## joule = scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## watt = scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## coulomb = scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none, none, none>>;\
+    using Ratio ## volt = scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using Ratio ## farad = scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using Ratio ## ohm = scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using Ratio ## siemens = scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using Ratio ## weber = scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using Ratio ## tesla = scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using Ratio ## henry = scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>;\
+    using Ratio ## Celsius = scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none, none, none>>;\
+    using Ratio ## lumen = scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio, one, none>>;\
+    using Ratio ## lux = scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio, one, none>>;\
+    using Ratio ## becquerel = scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>;\
+    using Ratio ## gray = scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>;\
+    using Ratio ## sievert = scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>;\
+    using Ratio ## katal = scalar<double, dimension, exponents<kat_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none, none, none>>;\
     namespace literals\
     {\
-        inline auto operator "" _ ## ShortPrefix ## Hz(long double n) { return scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## N(long double n) { return scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## Pa(long double n) { return scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## J(long double n) { return scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## W(long double n) { return scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## C(long double n) { return scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## V(long double n) { return scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## F(long double n) { return scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## Ω(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## ohm(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## S(long double n) { return scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## Wb(long double n) { return scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## T(long double n) { return scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## H(long double n) { return scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## degC(long double n) { return scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## lm(long double n) { return scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## lx(long double n) { return scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## Bq(long double n) { return scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## Gy(long double n) { return scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## Sv(long double n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## kat(long double n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Hz(long double n) { return scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Hz(unsigned long long n) { return scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## rad(long double n) { return scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, Ratio, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## rad(unsigned long long n) { return scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, Ratio, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## N(long double n) { return scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## N(unsigned long long n) { return scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Pa(long double n) { return scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Pa(unsigned long long n) { return scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## J(long double n) { return scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## J(unsigned long long n) { return scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## W(long double n) { return scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## W(unsigned long long n) { return scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## C(long double n) { return scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## C(unsigned long long n) { return scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## V(long double n) { return scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## V(unsigned long long n) { return scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## F(long double n) { return scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## F(unsigned long long n) { return scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Ω(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Ω(unsigned long long n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## ohm(long double n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## ohm(unsigned long long n) { return scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## S(long double n) { return scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## S(unsigned long long n) { return scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Wb(long double n) { return scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Wb(unsigned long long n) { return scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## T(long double n) { return scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## T(unsigned long long n) { return scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## H(long double n) { return scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## H(unsigned long long n) { return scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## degC(long double n) { return scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## degC(unsigned long long n) { return scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## lm(long double n) { return scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio, one, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## lm(unsigned long long n) { return scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio, one, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## lx(long double n) { return scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio, one, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## lx(unsigned long long n) { return scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio, one, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Bq(long double n) { return scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Bq(unsigned long long n) { return scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Gy(long double n) { return scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Gy(unsigned long long n) { return scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Sv(long double n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## Sv(unsigned long long n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## kat(long double n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## kat(unsigned long long n) { return scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none, none, none>>{ static_cast<double>(n) }; }\
+        namespace exact\
+        {\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## Hz() { return make_exact_literal<scalar<double, dimension, exponents<Hz_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## rad() { return make_exact_literal<scalar<double, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, Ratio, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## N() { return make_exact_literal<scalar<double, dimension, exponents<N_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## Pa() { return make_exact_literal<scalar<double, dimension, exponents<Pa_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## J() { return make_exact_literal<scalar<double, dimension, exponents<J_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## W() { return make_exact_literal<scalar<double, dimension, exponents<W_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## C() { return make_exact_literal<scalar<double, dimension, exponents<C_EXPONENTS>, ratios<Ratio, none, none, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## V() { return make_exact_literal<scalar<double, dimension, exponents<V_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## F() { return make_exact_literal<scalar<double, dimension, exponents<F_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## Ω() { return make_exact_literal<scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## ohm() { return make_exact_literal<scalar<double, dimension, exponents<Ω_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## S() { return make_exact_literal<scalar<double, dimension, exponents<S_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## Wb() { return make_exact_literal<scalar<double, dimension, exponents<Wb_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## T() { return make_exact_literal<scalar<double, dimension, exponents<T_EXPONENTS>, ratios<Ratio, none, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## H() { return make_exact_literal<scalar<double, dimension, exponents<H_EXPONENTS>, ratios<Ratio, Ratio, ratio_multiply<kilo, Ratio>, Ratio, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## degC() { return make_exact_literal<scalar<double, dimension, exponents<degC_EXPONENTS>, ratios<none, none, none, none, Ratio, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## lm() { return make_exact_literal<scalar<double, dimension, exponents<lm_EXPONENTS>, ratios<none, none, none, none, none, none, Ratio, one, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## lx() { return make_exact_literal<scalar<double, dimension, exponents<lx_EXPONENTS>, ratios<none, Ratio, none, none, none, none, Ratio, one, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## Bq() { return make_exact_literal<scalar<double, dimension, exponents<Bq_EXPONENTS>, ratios<Ratio, none, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## Gy() { return make_exact_literal<scalar<double, dimension, exponents<Gy_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## Sv() { return make_exact_literal<scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, Ratio, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## kat() { return make_exact_literal<scalar<double, dimension, exponents<Sv_EXPONENTS>, ratios<Ratio, none, none, none, none, Ratio, none, none, none>>, Chars...>(); }\
+        }\
     }
 
     // Visual Studio hack
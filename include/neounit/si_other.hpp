@@ -42,39 +42,99 @@
 
 namespace neounit::si
 {
-    // s m g A K mol cd
+    // s m g A K mol cd rad B
 
-    #define h_EXPONENTS 1, 0, 0, 0, 0, 0, 0
-    #define t_EXPONENTS 0, 0, 1, 0, 0, 0, 0
+    #define h_EXPONENTS 1, 0, 0, 0, 0, 0, 0, 0, 0
+    #define t_EXPONENTS 0, 0, 1, 0, 0, 0, 0, 0, 0
+    #define deg_EXPONENTS 0, 0, 0, 0, 0, 0, 0, 1, 0
+    #define arcmin_EXPONENTS 0, 0, 0, 0, 0, 0, 0, 1, 0
+    #define arcsec_EXPONENTS 0, 0, 0, 0, 0, 0, 0, 1, 0
+    #define tr_EXPONENTS 0, 0, 0, 0, 0, 0, 0, 1, 0
 
-    template<typename T = double> using h = scalar<T, dimension, exponents<h_EXPONENTS>, ratios<ratio<60 * 60>, none, none, none, none, none, none>>;
-    template<typename T = double> using t = scalar<T, dimension, exponents<t_EXPONENTS>, ratios<none, none, mega, none, none, none, none>>;
+    // pi/180 with pi kept as an exponent so that powers of angles (e.g. arcsec^2 to sr) stay exact ratios;
+    // the other angle units are exact multiples of it so conversions between them are exact.
+    using degree_ratio = ratio<1, 180, 0, 0, 1>;
+    using arcminute_ratio = ratio_divide<degree_ratio, ratio<60>>;
+    using arcsecond_ratio = ratio_divide<degree_ratio, ratio<60 * 60>>;
+    using turn_ratio = ratio_multiply<degree_ratio, ratio<360>>;
+
+    template<typename T = double> using h = scalar<T, dimension, exponents<h_EXPONENTS>, ratios<ratio<60 * 60>, none, none, none, none, none, none, none, none>>;
+    template<typename T = double> using t = scalar<T, dimension, exponents<t_EXPONENTS>, ratios<none, none, mega, none, none, none, none, none, none>>;
+    template<typename T = double> using deg = scalar<T, dimension, exponents<deg_EXPONENTS>, ratios<none, none, none, none, none, none, none, degree_ratio, none>>;
+    template<typename T = double> using arcmin = scalar<T, dimension, exponents<arcmin_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcminute_ratio, none>>;
+    template<typename T = double> using arcsec = scalar<T, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcsecond_ratio, none>>;
+    template<typename T = double> using tr = scalar<T, dimension, exponents<tr_EXPONENTS>, ratios<none, none, none, none, none, none, none, turn_ratio, none>>;
 
     using hour = h<>;
     using tonne = t<>;
     using ton = tonne;
+    using degree = deg<>;
+    using arcminute = arcmin<>;
+    using arcsecond = arcsec<>;
+    using turn = tr<>;
 
     namespace literals
     {
-        inline auto operator "" _h(long double n) { return scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio<60 * 60>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
-        inline auto operator "" _t(long double n) { return scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, mega, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _h(long double n) { return scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio<60 * 60>, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _h(unsigned long long n) { return scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio<60 * 60>, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _t(long double n) { return scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, mega, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _t(unsigned long long n) { return scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, mega, none, none, none, none, none, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _deg(long double n) { return scalar<double, dimension, exponents<deg_EXPONENTS>, ratios<none, none, none, none, none, none, none, degree_ratio, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _deg(unsigned long long n) { return scalar<double, dimension, exponents<deg_EXPONENTS>, ratios<none, none, none, none, none, none, none, degree_ratio, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _arcmin(long double n) { return scalar<double, dimension, exponents<arcmin_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcminute_ratio, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _arcmin(unsigned long long n) { return scalar<double, dimension, exponents<arcmin_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcminute_ratio, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _arcsec(long double n) { return scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcsecond_ratio, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _arcsec(unsigned long long n) { return scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcsecond_ratio, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _tr(long double n) { return scalar<double, dimension, exponents<tr_EXPONENTS>, ratios<none, none, none, none, none, none, none, turn_ratio, none>>{ static_cast<double>(n) }; }
+        constexpr inline auto operator "" _tr(unsigned long long n) { return scalar<double, dimension, exponents<tr_EXPONENTS>, ratios<none, none, none, none, none, none, none, turn_ratio, none>>{ static_cast<double>(n) }; }
+        namespace exact
+        {
+            template <char... Chars> consteval auto operator "" _h() { return make_exact_literal<scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio<60 * 60>, none, none, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _t() { return make_exact_literal<scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, mega, none, none, none, none, none, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _deg() { return make_exact_literal<scalar<double, dimension, exponents<deg_EXPONENTS>, ratios<none, none, none, none, none, none, none, degree_ratio, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _arcmin() { return make_exact_literal<scalar<double, dimension, exponents<arcmin_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcminute_ratio, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _arcsec() { return make_exact_literal<scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, arcsecond_ratio, none>>, Chars...>(); }
+            template <char... Chars> consteval auto operator "" _tr() { return make_exact_literal<scalar<double, dimension, exponents<tr_EXPONENTS>, ratios<none, none, none, none, none, none, none, turn_ratio, none>>, Chars...>(); }
+        }
     }
 
     template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::Time, E, ratio<60 * 60>> { static inline auto const value = std::string{ ratio_short_prefix<apply_power_sign_t<ratio<60 * 60>, E>>::prefix } + "h"; };
     template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::Time, E, ratio<60 * 60>> { static inline auto const value = std::u8string{ ratio_short_u8prefix<apply_power_sign_t<ratio<60 * 60>, E>>::prefix } + u8"h"; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::PlaneAngle, E, degree_ratio> { static inline auto const value = std::string{ "deg" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::PlaneAngle, E, degree_ratio> { static inline auto const value = std::u8string{ u8"°" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::PlaneAngle, E, arcminute_ratio> { static inline auto const value = std::string{ "arcmin" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::PlaneAngle, E, arcminute_ratio> { static inline auto const value = std::u8string{ u8"′" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::PlaneAngle, E, arcsecond_ratio> { static inline auto const value = std::string{ "arcsec" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::PlaneAngle, E, arcsecond_ratio> { static inline auto const value = std::u8string{ u8"″" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::PlaneAngle, E, turn_ratio> { static inline auto const value = std::string{ "tr" }; };
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::PlaneAngle, E, turn_ratio> { static inline auto const value = std::u8string{ u8"tr" }; };
 
     #define define_si_other_prefix(ShortPrefix, Ratio)\
     template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::Time, E, ratio_multiply<ratio<60 * 60>, Ratio>> { static inline auto const value = std::string{ ratio_short_prefix<apply_power_sign_t<Ratio, E>>::prefix } + "h"; };\
     template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::Time, E, ratio_multiply<ratio<60 * 60>, Ratio>> { static inline auto const value = std::u8string{ ratio_short_u8prefix<apply_power_sign_t<Ratio, E>>::prefix } + u8"h"; };\
-    using ShortPrefix ## hour = scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none>>;\
-    using ShortPrefix ## t = scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none>>;\
-    using Ratio ## hour = scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none>>;\
-    using Ratio ## tonne = scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none>>;\
-    using Ratio ## ton = scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none>>;\
+    using ShortPrefix ## hour = scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none, none, none>>;\
+    using ShortPrefix ## t = scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## hour = scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none, none, none>>;\
+    using Ratio ## tonne = scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none, none, none>>;\
+    using Ratio ## ton = scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none, none, none>>;\
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_string<dimension::PlaneAngle, E, ratio_multiply<arcsecond_ratio, Ratio>> { static inline auto const value = std::string{ ratio_short_prefix<apply_power_sign_t<Ratio, E>>::prefix } + "arcsec"; };\
+    template <dimensional_exponent E> struct base_unit_pre_exponent_to_u8string<dimension::PlaneAngle, E, ratio_multiply<arcsecond_ratio, Ratio>> { static inline auto const value = std::u8string{ ratio_short_u8prefix<apply_power_sign_t<Ratio, E>>::prefix } + u8"″"; };\
+    using ShortPrefix ## arcsec = scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, ratio_multiply<arcsecond_ratio, Ratio>, none>>;\
+    using Ratio ## arcsecond = scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, ratio_multiply<arcsecond_ratio, Ratio>, none>>;\
     namespace literals\
     {\
-        inline auto operator "" _ ## ShortPrefix ## h(long double n) { return scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
-        inline auto operator "" _ ## ShortPrefix ## t(long double n) { return scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## h(long double n) { return scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## h(unsigned long long n) { return scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## t(long double n) { return scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## t(unsigned long long n) { return scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none, none, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## arcsec(long double n) { return scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, ratio_multiply<arcsecond_ratio, Ratio>, none>>{ static_cast<double>(n) }; }\
+        constexpr inline auto operator "" _ ## ShortPrefix ## arcsec(unsigned long long n) { return scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, ratio_multiply<arcsecond_ratio, Ratio>, none>>{ static_cast<double>(n) }; }\
+        namespace exact\
+        {\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## h() { return make_exact_literal<scalar<double, dimension, exponents<h_EXPONENTS>, ratios<ratio_multiply<ratio<60 * 60>, Ratio>, none, none, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## t() { return make_exact_literal<scalar<double, dimension, exponents<t_EXPONENTS>, ratios<none, none, ratio_multiply<mega, Ratio>, none, none, none, none, none, none>>, Chars...>(); }\
+            template <char... Chars> consteval auto operator "" _ ## ShortPrefix ## arcsec() { return make_exact_literal<scalar<double, dimension, exponents<arcsec_EXPONENTS>, ratios<none, none, none, none, none, none, none, ratio_multiply<arcsecond_ratio, Ratio>, none>>, Chars...>(); }\
+        }\
     }
 
     define_si_other_prefix(q, quecto)
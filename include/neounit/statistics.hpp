@@ -0,0 +1,393 @@
+// statistics.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+#include <neounit/math.hpp>
+
+namespace neounit
+{
+    // Streaming statistics over quantities. Result units follow from the exponent arithmetic: the variance of a
+    // metre series is a square metre and its standard deviation a metre. All accumulators except ewma are mergeable
+    // so per-thread accumulators can be combined.
+
+    /// Count, mean, variance (Welford), minimum and maximum.
+    template <typename Quantity>
+    class running_statistics
+    {
+        static_assert(std::is_floating_point_v<typename Quantity::value_type>, "neounit::running_statistics: value type must be floating point");
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+        using variance_type = decltype(std::declval<quantity_type>() * std::declval<quantity_type>());
+    public:
+        constexpr void add(quantity_type const& aSample)
+        {
+            ++iCount;
+            auto const delta = aSample - iMean;
+            iMean = iMean + delta / static_cast<value_type>(iCount);
+            iSumOfSquares = iSumOfSquares + delta * (aSample - iMean);
+            iMinimum = std::min(iMinimum, aSample);
+            iMaximum = std::max(iMaximum, aSample);
+        }
+        /// Adds a block of samples: the block's sum, squared deviations and extremes are computed in independent
+        /// passes (which vectorize) and then merged.
+        void add(std::span<quantity_type const> aSamples)
+        {
+            if (aSamples.empty())
+                return;
+            auto const samples = aSamples.data();
+            auto const count = aSamples.size();
+            value_type sum{};
+            value_type minimum = std::numeric_limits<value_type>::infinity();
+            value_type maximum = -std::numeric_limits<value_type>::infinity();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto const sample = static_cast<value_type>(samples[i]);
+                sum += sample;
+                minimum = std::min(minimum, sample);
+                maximum = std::max(maximum, sample);
+            }
+            auto const mean = sum / static_cast<value_type>(count);
+            value_type sumOfSquares{};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto const deviation = static_cast<value_type>(samples[i]) - mean;
+                sumOfSquares += deviation * deviation;
+            }
+            running_statistics block;
+            block.iCount = count;
+            block.iMean = mean;
+            block.iSumOfSquares = sumOfSquares;
+            block.iMinimum = minimum;
+            block.iMaximum = maximum;
+            merge(block);
+        }
+        /// Combines the statistics of another sample set (Chan et al.).
+        constexpr void merge(running_statistics const& aOther)
+        {
+            if (aOther.iCount == 0)
+                return;
+            if (iCount == 0)
+            {
+                *this = aOther;
+                return;
+            }
+            auto const count = iCount + aOther.iCount;
+            auto const delta = aOther.iMean - iMean;
+            auto const otherWeight = static_cast<value_type>(aOther.iCount) / static_cast<value_type>(count);
+            iMean = iMean + delta * otherWeight;
+            iSumOfSquares = iSumOfSquares + aOther.iSumOfSquares + delta * delta * (static_cast<value_type>(iCount) * otherWeight);
+            iCount = count;
+            iMinimum = std::min(iMinimum, aOther.iMinimum);
+            iMaximum = std::max(iMaximum, aOther.iMaximum);
+        }
+    public:
+        constexpr std::size_t count() const
+        {
+            return iCount;
+        }
+        constexpr quantity_type mean() const
+        {
+            return iMean;
+        }
+        /// Sample variance (Bessel's correction); 0 for fewer than two samples.
+        constexpr variance_type variance() const
+        {
+            return iCount > 1 ? iSumOfSquares / static_cast<value_type>(iCount - 1) : variance_type{};
+        }
+        constexpr variance_type population_variance() const
+        {
+            return iCount > 0 ? iSumOfSquares / static_cast<value_type>(iCount) : variance_type{};
+        }
+        quantity_type standard_deviation() const
+        {
+            return sqrt(variance());
+        }
+        constexpr quantity_type minimum() const
+        {
+            return iMinimum;
+        }
+        constexpr quantity_type maximum() const
+        {
+            return iMaximum;
+        }
+    private:
+        std::size_t iCount = 0;
+        quantity_type iMean{};
+        variance_type iSumOfSquares{};
+        quantity_type iMinimum{ std::numeric_limits<value_type>::infinity() };
+        quantity_type iMaximum{ -std::numeric_limits<value_type>::infinity() };
+    };
+
+    /// Exponentially weighted moving average; the first sample initializes the average.
+    template <typename Quantity>
+    class ewma
+    {
+        static_assert(std::is_floating_point_v<typename Quantity::value_type>, "neounit::ewma: value type must be floating point");
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+    public:
+        constexpr explicit ewma(value_type aAlpha) : iAlpha{ aAlpha }
+        {
+        }
+    public:
+        constexpr void add(quantity_type const& aSample)
+        {
+            iValue = iPrimed ? iValue + (aSample - iValue) * iAlpha : aSample;
+            iPrimed = true;
+        }
+        constexpr quantity_type value() const
+        {
+            return iValue;
+        }
+    private:
+        value_type iAlpha;
+        quantity_type iValue{};
+        bool iPrimed = false;
+    };
+
+    /// Mergeable quantile sketch with bounded relative error (logarithmic buckets, as DDSketch): a quantile is
+    /// returned to within aRelativeAccuracy of the true sample value. Infinite samples rank at the ends and
+    /// NaN samples are only counted (see nans()).
+    template <typename Quantity>
+    class quantile_sketch
+    {
+        static_assert(std::is_floating_point_v<typename Quantity::value_type>, "neounit::quantile_sketch: value type must be floating point");
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+    private:
+        struct buckets
+        {
+            std::int32_t offset = 0;
+            std::vector<std::uint64_t> counts;
+
+            void add(std::int32_t aIndex, std::uint64_t aCount)
+            {
+                if (counts.empty())
+                    offset = aIndex;
+                else if (aIndex < offset)
+                {
+                    counts.insert(counts.begin(), static_cast<std::size_t>(offset - aIndex), 0u);
+                    offset = aIndex;
+                }
+                auto const position = static_cast<std::size_t>(aIndex - offset);
+                if (position >= counts.size())
+                    counts.resize(position + 1u, 0u);
+                counts[position] += aCount;
+            }
+            void merge(buckets const& aOther)
+            {
+                for (std::size_t i = 0; i < aOther.counts.size(); ++i)
+                    if (aOther.counts[i] != 0u)
+                        add(aOther.offset + static_cast<std::int32_t>(i), aOther.counts[i]);
+            }
+        };
+    public:
+        explicit quantile_sketch(value_type aRelativeAccuracy = static_cast<value_type>(0.01)) :
+            iGamma{ (1 + aRelativeAccuracy) / (1 - aRelativeAccuracy) }, iLogGamma{ std::log(iGamma) }
+        {
+        }
+    public:
+        void add(quantity_type const& aSample)
+        {
+            auto const sample = static_cast<value_type>(aSample);
+            if (std::isnan(sample))
+            {
+                ++iNaNs;
+                return;
+            }
+            ++iCount;
+            if (std::isinf(sample))
+                ++(sample > 0 ? iPositiveInfinities : iNegativeInfinities);
+            else if (sample > 0)
+                iPositive.add(index(sample), 1u);
+            else if (sample < 0)
+                iNegative.add(index(-sample), 1u);
+            else
+                ++iZeros;
+        }
+        void merge(quantile_sketch const& aOther)
+        {
+            if (aOther.iGamma != iGamma)
+                throw std::invalid_argument("neounit::quantile_sketch::merge: different accuracy");
+            iPositive.merge(aOther.iPositive);
+            iNegative.merge(aOther.iNegative);
+            iZeros += aOther.iZeros;
+            iPositiveInfinities += aOther.iPositiveInfinities;
+            iNegativeInfinities += aOther.iNegativeInfinities;
+            iNaNs += aOther.iNaNs;
+            iCount += aOther.iCount;
+        }
+    public:
+        /// Samples ranked, i.e. excluding NaNs.
+        std::uint64_t count() const
+        {
+            return iCount;
+        }
+        std::uint64_t nans() const
+        {
+            return iNaNs;
+        }
+        /// The aQuantile (0 to 1) quantile of the samples added.
+        quantity_type quantile(value_type aQuantile) const
+        {
+            if (iCount == 0)
+                throw std::logic_error("neounit::quantile_sketch::quantile: no samples");
+            auto const rank = static_cast<std::uint64_t>(std::clamp<value_type>(aQuantile, 0, 1) * static_cast<value_type>(iCount - 1));
+            std::uint64_t seen = 0;
+            if ((seen += iNegativeInfinities) > rank)
+                return -std::numeric_limits<value_type>::infinity();
+            for (std::size_t i = iNegative.counts.size(); i-- > 0;)
+                if ((seen += iNegative.counts[i]) > rank)
+                    return -value(iNegative.offset + static_cast<std::int32_t>(i));
+            if ((seen += iZeros) > rank)
+                return value_type{};
+            for (std::size_t i = 0; i < iPositive.counts.size(); ++i)
+                if ((seen += iPositive.counts[i]) > rank)
+                    return value(iPositive.offset + static_cast<std::int32_t>(i));
+            return std::numeric_limits<value_type>::infinity();
+        }
+    private:
+        std::int32_t index(value_type aMagnitude) const
+        {
+            return static_cast<std::int32_t>(std::ceil(std::log(aMagnitude) / iLogGamma));
+        }
+        value_type value(std::int32_t aIndex) const
+        {
+            return 2 * std::pow(iGamma, static_cast<value_type>(aIndex)) / (iGamma + 1);
+        }
+    private:
+        value_type iGamma;
+        value_type iLogGamma;
+        buckets iPositive;
+        buckets iNegative;
+        std::uint64_t iZeros = 0;
+        std::uint64_t iPositiveInfinities = 0;
+        std::uint64_t iNegativeInfinities = 0;
+        std::uint64_t iNaNs = 0;
+        std::uint64_t iCount = 0;
+    };
+
+    /// Fixed width bins over [aLower, aUpper) with bin edges in the quantity's unit; samples outside the range
+    /// are counted as underflow and overflow and NaN samples separately.
+    template <typename Quantity>
+    class histogram
+    {
+        static_assert(std::is_floating_point_v<typename Quantity::value_type>, "neounit::histogram: value type must be floating point");
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+    public:
+        histogram(quantity_type const& aLower, quantity_type const& aUpper, std::size_t aBins) :
+            iLower{ aLower }, iUpper{ aUpper }, iScale{ static_cast<value_type>(aBins) / ((aUpper - aLower) / value_type{ 1 }) }, iCounts(aBins + 2u, 0u)
+        {
+            if (aBins == 0 || !(aLower < aUpper))
+                throw std::invalid_argument("neounit::histogram: invalid range");
+        }
+    public:
+        /// The bin is computed in floating point and clamped to the underflow/overflow bins; the only branch
+        /// is for a NaN position, which std::clamp would pass through.
+        void add(quantity_type const& aSample)
+        {
+            auto const position = static_cast<value_type>(aSample - iLower) * iScale + 1;
+            if (std::isnan(position))
+            {
+                ++iNaNs;
+                return;
+            }
+            auto const bin = std::clamp<value_type>(std::floor(position), 0, static_cast<value_type>(iCounts.size() - 1u));
+            ++iCounts[static_cast<std::size_t>(bin)];
+        }
+        void add(std::span<quantity_type const> aSamples)
+        {
+            for (auto const& sample : aSamples)
+                add(sample);
+        }
+        void merge(histogram const& aOther)
+        {
+            if (aOther.iLower != iLower || aOther.iUpper != iUpper || aOther.iCounts.size() != iCounts.size())
+                throw std::invalid_argument("neounit::histogram::merge: different bins");
+            for (std::size_t i = 0; i < iCounts.size(); ++i)
+                iCounts[i] += aOther.iCounts[i];
+            iNaNs += aOther.iNaNs;
+        }
+    public:
+        std::size_t bins() const
+        {
+            return iCounts.size() - 2u;
+        }
+        /// Lower edge of bin aBin; edge(bins()) is the upper end of the range.
+        quantity_type edge(std::size_t aBin) const
+        {
+            return iLower + (iUpper - iLower) * (static_cast<value_type>(aBin) / static_cast<value_type>(bins()));
+        }
+        std::uint64_t count(std::size_t aBin) const
+        {
+            return iCounts[aBin + 1u];
+        }
+        std::uint64_t underflow() const
+        {
+            return iCounts.front();
+        }
+        std::uint64_t overflow() const
+        {
+            return iCounts.back();
+        }
+        std::uint64_t nans() const
+        {
+            return iNaNs;
+        }
+    private:
+        quantity_type iLower;
+        quantity_type iUpper;
+        value_type iScale;
+        std::vector<std::uint64_t> iCounts;
+        std::uint64_t iNaNs = 0;
+    };
+}
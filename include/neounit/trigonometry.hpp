@@ -0,0 +1,273 @@
+// trigonometry.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <bit>
+#include <span>
+#include <utility>
+#include <limits>
+#include <stdexcept>
+
+#include <neounit/unit.hpp>
+#include <neounit/si.hpp>
+#include <neounit/si_derived.hpp>
+#include <neounit/si_other.hpp>
+
+namespace neounit::si
+{
+    template <typename Ratio, typename T = double>
+    using angle = scalar<T, dimension, exponents<rad_EXPONENTS(1)>, ratios<none, none, none, none, none, none, none, Ratio, none>>;
+
+    namespace detail
+    {
+        // Number of Ratio angle units in a turn if that is an integer, otherwise 0. The decimal exponent is folded
+        // into the fraction first as e.g. a turn in kiloarcseconds is kept as 1296000e-3.
+        template <typename Ratio>
+        struct units_per_turn
+        {
+            using calc = ratio_divide<turn_ratio, Ratio>;
+            static constexpr std::intmax_t compute()
+            {
+                if (calc::exp_pi != 0 || calc::exp2 != 0)
+                    return 0;
+                std::intmax_t num = calc::num;
+                std::intmax_t den = calc::den;
+                for (auto e = calc::exp; e > 0; --e)
+                {
+                    if (num > std::numeric_limits<std::intmax_t>::max() / 10)
+                        return 0;
+                    num *= 10;
+                }
+                for (auto e = calc::exp; e < 0; ++e)
+                {
+                    if (den > num)
+                        return 0;
+                    den *= 10;
+                }
+                return num % den == 0 ? num / den : 0;
+            }
+            static constexpr std::intmax_t value = compute();
+        };
+        template <typename Ratio>
+        constexpr std::intmax_t units_per_turn_v = units_per_turn<Ratio>::value;
+
+        constexpr double pi = 3.14159265358979323846;
+
+        /// Polynomial kernels for sin and cos on [-quarter/2, quarter/2] of a reduced argument; these are the
+        /// fdlibm __kernel_sin/__kernel_cos minimax coefficients with the unit-to-radian scale folded in,
+        /// so degree, arcminute, arcsecond and turn arguments are never multiplied by a conversion factor.
+        template <std::intmax_t UnitsPerTurn>
+        struct trig_kernel
+        {
+            static constexpr double k = UnitsPerTurn != 0 ? 2.0 * pi / static_cast<double>(UnitsPerTurn) : 1.0;
+            static constexpr double k2 = k * k;
+            static constexpr double quarter = UnitsPerTurn != 0 ? static_cast<double>(UnitsPerTurn) / 4.0 : pi / 2.0;
+            static constexpr double inverse_quarter = UnitsPerTurn != 0 ? 4.0 / static_cast<double>(UnitsPerTurn) : 2.0 / pi;
+            static constexpr double s0 = k;
+            static constexpr double s1 = -1.66666666666666324348e-01 * k * k2;
+            static constexpr double s2 = 8.33333333332248946124e-03 * k * k2 * k2;
+            static constexpr double s3 = -1.98412698298579493134e-04 * k * k2 * k2 * k2;
+            static constexpr double s4 = 2.75573137070700676789e-06 * k * k2 * k2 * k2 * k2;
+            static constexpr double s5 = -2.50507602534068634195e-08 * k * k2 * k2 * k2 * k2 * k2;
+            static constexpr double s6 = 1.58969099521155010221e-10 * k * k2 * k2 * k2 * k2 * k2 * k2;
+            static constexpr double c1 = -0.5 * k2;
+            static constexpr double c2 = 4.16666666666666019037e-02 * k2 * k2;
+            static constexpr double c3 = -1.38888888888741095749e-03 * k2 * k2 * k2;
+            static constexpr double c4 = 2.48015872894767294178e-05 * k2 * k2 * k2 * k2;
+            static constexpr double c5 = -2.75573143513906633035e-07 * k2 * k2 * k2 * k2 * k2;
+            static constexpr double c6 = 2.08757232129817482790e-09 * k2 * k2 * k2 * k2 * k2 * k2;
+            static constexpr double c7 = -1.13596475577881948265e-11 * k2 * k2 * k2 * k2 * k2 * k2 * k2;
+
+            /// Branch-free evaluation; inlined into the batch loops it auto-vectorizes.
+            /// Turn-based units reduce exactly (x - n * quarter has no rounding error), so sin(180 deg) is 0.
+            /// Radians use a three part Cody-Waite reduction which is accurate to within 2 ulp for |x| <= 2^20.
+            static inline void evaluate(double x, double& aSin, double& aCos)
+            {
+                constexpr double magic = 0x1.8p52;
+                auto const kd = x * inverse_quarter + magic;
+                auto const n = kd - magic;
+                auto const q = std::bit_cast<std::uint64_t>(kd);
+                double f;
+                if constexpr (UnitsPerTurn != 0)
+                    f = x - n * quarter;
+                else
+                    f = ((x - n * 1.57079632673412561417e+00) - n * 6.07710050630396597660e-11) - n * 2.02226624879595063154e-21;
+                auto const z = f * f;
+                auto const s = f * (s0 + z * (s1 + z * (s2 + z * (s3 + z * (s4 + z * (s5 + z * s6))))));
+                auto const c = 1.0 + z * (c1 + z * (c2 + z * (c3 + z * (c4 + z * (c5 + z * (c6 + z * c7))))));
+                auto const sBits = std::bit_cast<std::uint64_t>(s);
+                auto const cBits = std::bit_cast<std::uint64_t>(c);
+                auto const swap = 0u - (q & 1u);
+                auto const sinSign = (q & 2u) << 62;
+                auto const cosSign = ((q + 1u) & 2u) << 62;
+                aSin = std::bit_cast<double>(((sBits & ~swap) | (cBits & swap)) ^ sinSign);
+                aCos = std::bit_cast<double>(((cBits & ~swap) | (sBits & swap)) ^ cosSign);
+            }
+        };
+
+        template <typename Angle>
+        struct angle_traits {};
+        template <typename T, typename Ratio>
+        struct angle_traits<angle<Ratio, T>>
+        {
+            using value_type = T;
+            using ratio_type = Ratio;
+            static constexpr std::intmax_t units_per_turn = units_per_turn_v<Ratio>;
+            // Argument as passed to trig_kernel: as is for turn-based units, otherwise converted to radians.
+            static constexpr double to_kernel(angle<Ratio, T> const& aAngle)
+            {
+                if constexpr (units_per_turn != 0 || std::is_same_v<Ratio, one>)
+                    return static_cast<double>(static_cast<T>(aAngle));
+                else
+                    return static_cast<double>(static_cast<T>(conversion_cast<angle<one, T>>(aAngle)));
+            }
+        };
+    }
+
+    template <typename T, typename Ratio>
+    inline T sin(angle<Ratio, T> const& aAngle)
+    {
+        using traits = detail::angle_traits<angle<Ratio, T>>;
+        if constexpr (traits::units_per_turn == 0)
+            return std::sin(static_cast<T>(traits::to_kernel(aAngle)));
+        else
+        {
+            double s, c;
+            detail::trig_kernel<traits::units_per_turn>::evaluate(traits::to_kernel(aAngle), s, c);
+            return static_cast<T>(s);
+        }
+    }
+
+    template <typename T, typename Ratio>
+    inline T cos(angle<Ratio, T> const& aAngle)
+    {
+        using traits = detail::angle_traits<angle<Ratio, T>>;
+        if constexpr (traits::units_per_turn == 0)
+            return std::cos(static_cast<T>(traits::to_kernel(aAngle)));
+        else
+        {
+            double s, c;
+            detail::trig_kernel<traits::units_per_turn>::evaluate(traits::to_kernel(aAngle), s, c);
+            return static_cast<T>(c);
+        }
+    }
+
+    template <typename T, typename Ratio>
+    inline std::pair<T, T> sincos(angle<Ratio, T> const& aAngle)
+    {
+        using traits = detail::angle_traits<angle<Ratio, T>>;
+        if constexpr (traits::units_per_turn == 0)
+        {
+            auto const x = static_cast<T>(traits::to_kernel(aAngle));
+            return { std::sin(x), std::cos(x) };
+        }
+        else
+        {
+            double s, c;
+            detail::trig_kernel<traits::units_per_turn>::evaluate(traits::to_kernel(aAngle), s, c);
+            return { static_cast<T>(s), static_cast<T>(c) };
+        }
+    }
+
+    /// Angle of the vector (aX, aY); the result type defaults to radians.
+    template <typename Angle = void, typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline auto atan2(scalar<T, Dimension, Exponents, Ratios> const& aY, scalar<T, Dimension, Exponents, Ratios> const& aX)
+    {
+        rad<T> const result{ std::atan2(static_cast<T>(aY), static_cast<T>(aX)) };
+        if constexpr (std::is_same_v<Angle, void>)
+            return result;
+        else
+            return conversion_cast<Angle>(result);
+    }
+
+    /// Batch sin using detail::trig_kernel; arguments in radians are accurate for |x| <= 2^20 rad.
+    template <typename Angle, typename T>
+    inline void sin(std::span<Angle> aInput, std::span<T> aOutput)
+    {
+        using traits = detail::angle_traits<std::remove_cv_t<Angle>>;
+        if (aOutput.size() < aInput.size())
+            throw std::invalid_argument("neounit::si::sin: output too small");
+        auto const count = aInput.size();
+        auto const input = aInput.data();
+        auto const output = aOutput.data();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            double s, c;
+            detail::trig_kernel<traits::units_per_turn>::evaluate(traits::to_kernel(input[i]), s, c);
+            output[i] = static_cast<T>(s);
+        }
+    }
+
+    /// Batch cos using detail::trig_kernel; arguments in radians are accurate for |x| <= 2^20 rad.
+    template <typename Angle, typename T>
+    inline void cos(std::span<Angle> aInput, std::span<T> aOutput)
+    {
+        using traits = detail::angle_traits<std::remove_cv_t<Angle>>;
+        if (aOutput.size() < aInput.size())
+            throw std::invalid_argument("neounit::si::cos: output too small");
+        auto const count = aInput.size();
+        auto const input = aInput.data();
+        auto const output = aOutput.data();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            double s, c;
+            detail::trig_kernel<traits::units_per_turn>::evaluate(traits::to_kernel(input[i]), s, c);
+            output[i] = static_cast<T>(c);
+        }
+    }
+
+    /// Batch sincos using detail::trig_kernel; arguments in radians are accurate for |x| <= 2^20 rad.
+    template <typename Angle, typename T>
+    inline void sincos(std::span<Angle> aInput, std::span<T> aSinOutput, std::span<T> aCosOutput)
+    {
+        using traits = detail::angle_traits<std::remove_cv_t<Angle>>;
+        if (aSinOutput.size() < aInput.size() || aCosOutput.size() < aInput.size())
+            throw std::invalid_argument("neounit::si::sincos: output too small");
+        auto const count = aInput.size();
+        auto const input = aInput.data();
+        auto const sinOutput = aSinOutput.data();
+        auto const cosOutput = aCosOutput.data();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            double s, c;
+            detail::trig_kernel<traits::units_per_turn>::evaluate(traits::to_kernel(input[i]), s, c);
+            sinOutput[i] = static_cast<T>(s);
+            cosOutput[i] = static_cast<T>(c);
+        }
+    }
+}
\ No newline at end of file
@@ -37,10 +37,15 @@
 
 #include <cstdint>
 #include <numeric>
+#include <numbers>
 #include <limits>
 #include <ratio>
+#include <stdexcept>
 #include <unordered_map>
 #include <string>
+#ifdef NEOUNIT_INSTRUMENT_CONVERSIONS
+#include <neounit/instrument.hpp>
+#endif
 
 namespace neounit
 {
@@ -88,30 +93,34 @@ namespace neounit
     template <dimensional_exponent... Exponents>
     struct exponents {};
 
-    template<std::intmax_t Num, std::intmax_t Denom = 1, std::intmax_t Exp = 0>
+    /// Num / Denom * 10^Exp * 2^BinaryExp * pi^PiExp; the binary exponent carries the IEC prefixes (kibi, mebi...)
+    /// exactly and the pi exponent the angle units (degree, arcminute...) so that their powers stay exact.
+    template<std::intmax_t Num, std::intmax_t Denom = 1, std::intmax_t Exp = 0, std::intmax_t BinaryExp = 0, std::intmax_t PiExp = 0>
     struct ratio : std::ratio<Num, Denom>
     {
         static constexpr std::intmax_t exp = Exp;
+        static constexpr std::intmax_t exp2 = BinaryExp;
+        static constexpr std::intmax_t exp_pi = PiExp;
     };
 
     template<typename Lhs, typename Rhs>
     struct ratio_multiply_impl;
-    template<std::intmax_t Num1, std::intmax_t Denom1, std::intmax_t Exp1, std::intmax_t Num2, std::intmax_t Denom2, std::intmax_t Exp2>
-    struct ratio_multiply_impl<ratio<Num1, Denom1, Exp1>, ratio<Num2, Denom2, Exp2>>
+    template<std::intmax_t Num1, std::intmax_t Denom1, std::intmax_t Exp1, std::intmax_t BinaryExp1, std::intmax_t PiExp1, std::intmax_t Num2, std::intmax_t Denom2, std::intmax_t Exp2, std::intmax_t BinaryExp2, std::intmax_t PiExp2>
+    struct ratio_multiply_impl<ratio<Num1, Denom1, Exp1, BinaryExp1, PiExp1>, ratio<Num2, Denom2, Exp2, BinaryExp2, PiExp2>>
     {
         using partial_type = std::ratio_multiply<std::ratio<Num1, Denom1>, std::ratio<Num2, Denom2>>;
-        using result_type = ratio<partial_type::num, partial_type::den, Exp1 + Exp2>;
+        using result_type = ratio<partial_type::num, partial_type::den, Exp1 + Exp2, BinaryExp1 + BinaryExp2, PiExp1 + PiExp2>;
     };
     template<typename Lhs, typename Rhs>
     using ratio_multiply = typename ratio_multiply_impl<Lhs, Rhs>::result_type;
 
     template<typename Lhs, typename Rhs>
     struct ratio_divide_impl;
-    template<std::intmax_t Num1, std::intmax_t Denom1, std::intmax_t Exp1, std::intmax_t Num2, std::intmax_t Denom2, std::intmax_t Exp2>
-    struct ratio_divide_impl<ratio<Num1, Denom1, Exp1>, ratio<Num2, Denom2, Exp2>>
+    template<std::intmax_t Num1, std::intmax_t Denom1, std::intmax_t Exp1, std::intmax_t BinaryExp1, std::intmax_t PiExp1, std::intmax_t Num2, std::intmax_t Denom2, std::intmax_t Exp2, std::intmax_t BinaryExp2, std::intmax_t PiExp2>
+    struct ratio_divide_impl<ratio<Num1, Denom1, Exp1, BinaryExp1, PiExp1>, ratio<Num2, Denom2, Exp2, BinaryExp2, PiExp2>>
     {
         using partial_type = std::ratio_divide<std::ratio<Num1, Denom1>, std::ratio<Num2, Denom2>>;
-        using result_type = ratio<partial_type::num, partial_type::den, Exp1 - Exp2>;
+        using result_type = ratio<partial_type::num, partial_type::den, Exp1 - Exp2, BinaryExp1 - BinaryExp2, PiExp1 - PiExp2>;
     };
     template<typename Lhs, typename Rhs>
     using ratio_divide = typename ratio_divide_impl<Lhs, Rhs>::result_type;
@@ -142,6 +151,14 @@ namespace neounit
     using yotta = ratio<1, 1, 24>;
     using ronna = ratio<1, 1, 27>;
     using quetta = ratio<1, 1, 30>;
+    using kibi = ratio<1, 1, 0, 10>;
+    using mebi = ratio<1, 1, 0, 20>;
+    using gibi = ratio<1, 1, 0, 30>;
+    using tebi = ratio<1, 1, 0, 40>;
+    using pebi = ratio<1, 1, 0, 50>;
+    using exbi = ratio<1, 1, 0, 60>;
+    using zebi = ratio<1, 1, 0, 70>;
+    using yobi = ratio<1, 1, 0, 80>;
 
     template <typename R>
     struct ratio_short_prefix { static constexpr std::string_view prefix = ""; };
@@ -169,6 +186,14 @@ namespace neounit
     template <> struct ratio_short_prefix<yotta> { static constexpr std::string_view prefix = "Y"; };
     template <> struct ratio_short_prefix<ronna> { static constexpr std::string_view prefix = "R"; };
     template <> struct ratio_short_prefix<quetta> { static constexpr std::string_view prefix = "Q"; };
+    template <> struct ratio_short_prefix<kibi> { static constexpr std::string_view prefix = "Ki"; };
+    template <> struct ratio_short_prefix<mebi> { static constexpr std::string_view prefix = "Mi"; };
+    template <> struct ratio_short_prefix<gibi> { static constexpr std::string_view prefix = "Gi"; };
+    template <> struct ratio_short_prefix<tebi> { static constexpr std::string_view prefix = "Ti"; };
+    template <> struct ratio_short_prefix<pebi> { static constexpr std::string_view prefix = "Pi"; };
+    template <> struct ratio_short_prefix<exbi> { static constexpr std::string_view prefix = "Ei"; };
+    template <> struct ratio_short_prefix<zebi> { static constexpr std::string_view prefix = "Zi"; };
+    template <> struct ratio_short_prefix<yobi> { static constexpr std::string_view prefix = "Yi"; };
 
     template <typename R>
     struct ratio_short_u8prefix { static constexpr std::u8string_view prefix = u8""; };
@@ -196,9 +221,17 @@ namespace neounit
     template <> struct ratio_short_u8prefix<yotta> { static constexpr std::u8string_view prefix = u8"Y"; };
     template <> struct ratio_short_u8prefix<ronna> { static constexpr std::u8string_view prefix = u8"R"; };
     template <> struct ratio_short_u8prefix<quetta> { static constexpr std::u8string_view prefix = u8"Q"; };
+    template <> struct ratio_short_u8prefix<kibi> { static constexpr std::u8string_view prefix = u8"Ki"; };
+    template <> struct ratio_short_u8prefix<mebi> { static constexpr std::u8string_view prefix = u8"Mi"; };
+    template <> struct ratio_short_u8prefix<gibi> { static constexpr std::u8string_view prefix = u8"Gi"; };
+    template <> struct ratio_short_u8prefix<tebi> { static constexpr std::u8string_view prefix = u8"Ti"; };
+    template <> struct ratio_short_u8prefix<pebi> { static constexpr std::u8string_view prefix = u8"Pi"; };
+    template <> struct ratio_short_u8prefix<exbi> { static constexpr std::u8string_view prefix = u8"Ei"; };
+    template <> struct ratio_short_u8prefix<zebi> { static constexpr std::u8string_view prefix = u8"Zi"; };
+    template <> struct ratio_short_u8prefix<yobi> { static constexpr std::u8string_view prefix = u8"Yi"; };
 
     template <typename Ratio>
-    struct apply_inverse { using result_type = ratio<Ratio::num, Ratio::den, -Ratio::exp>; };
+    struct apply_inverse { using result_type = ratio<Ratio::num, Ratio::den, -Ratio::exp, -Ratio::exp2, -Ratio::exp_pi>; };
     template <>
     struct apply_inverse<none> { using result_type = none; };
     template <typename Ratio>
@@ -251,45 +284,45 @@ namespace neounit
     template <typename Ratio>
     struct apply_power<Ratio, 0> { using result_type = one; };
     template <typename Ratio>
-    struct apply_power<Ratio, 1> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 0>::result_type>; };
+    struct apply_power<Ratio, 1> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 0>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 2> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 1>::result_type>; };
+    struct apply_power<Ratio, 2> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 1>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 3> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 2>::result_type>; };
+    struct apply_power<Ratio, 3> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 2>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 4> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 3>::result_type>; };
+    struct apply_power<Ratio, 4> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 3>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 5> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 4>::result_type>; };
+    struct apply_power<Ratio, 5> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 4>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 6> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 5>::result_type>; };
+    struct apply_power<Ratio, 6> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 5>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 7> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 6>::result_type>; };
+    struct apply_power<Ratio, 7> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 6>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 8> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 7>::result_type>; };
+    struct apply_power<Ratio, 8> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 7>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 9> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 8>::result_type>; };
+    struct apply_power<Ratio, 9> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 8>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, 10> { using result_type = typename ratio_multiply<Ratio, typename apply_power<Ratio, 9>::result_type>; };
+    struct apply_power<Ratio, 10> { using result_type = ratio_multiply<Ratio, typename apply_power<Ratio, 9>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -1> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 1>::result_type>; };
+    struct apply_power<Ratio, -1> { using result_type = apply_inverse_t<typename apply_power<Ratio, 1>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -2> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 2>::result_type>; };
+    struct apply_power<Ratio, -2> { using result_type = apply_inverse_t<typename apply_power<Ratio, 2>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -3> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 3>::result_type>; };
+    struct apply_power<Ratio, -3> { using result_type = apply_inverse_t<typename apply_power<Ratio, 3>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -4> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 4>::result_type>; };
+    struct apply_power<Ratio, -4> { using result_type = apply_inverse_t<typename apply_power<Ratio, 4>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -5> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 5>::result_type>; };
+    struct apply_power<Ratio, -5> { using result_type = apply_inverse_t<typename apply_power<Ratio, 5>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -6> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 6>::result_type>; };
+    struct apply_power<Ratio, -6> { using result_type = apply_inverse_t<typename apply_power<Ratio, 6>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -7> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 7>::result_type>; };
+    struct apply_power<Ratio, -7> { using result_type = apply_inverse_t<typename apply_power<Ratio, 7>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -8> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 8>::result_type>; };
+    struct apply_power<Ratio, -8> { using result_type = apply_inverse_t<typename apply_power<Ratio, 8>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -9> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 9>::result_type>; };
+    struct apply_power<Ratio, -9> { using result_type = apply_inverse_t<typename apply_power<Ratio, 9>::result_type>; };
     template <typename Ratio>
-    struct apply_power<Ratio, -10> { using result_type = typename apply_inverse_t<typename apply_power<Ratio, 10>::result_type>; };
+    struct apply_power<Ratio, -10> { using result_type = apply_inverse_t<typename apply_power<Ratio, 10>::result_type>; };
     template <typename Ratio, dimensional_exponent E>
     using apply_power_t = typename apply_power<Ratio, E>::result_type;
 
@@ -357,13 +390,66 @@ namespace neounit
     template <typename... Ratios>
     struct ratios
     {
-        using inverse_t = typename ratios<apply_inverse_t<Ratios>...>;
+        using inverse_t = ratios<apply_inverse_t<Ratios>...>;
         template <dimensional_exponent... E>
-        using apply_power_t = ratios<typename neounit::apply_power_t<Ratios, E>...>;
+        using apply_power_t = ratios<neounit::apply_power_t<Ratios, E>...>;
         template <dimensional_exponent... E>
-        using apply_power_sign_t = ratios<typename neounit::apply_power_sign_t<Ratios, E>...>;
+        using apply_power_sign_t = ratios<neounit::apply_power_sign_t<Ratios, E>...>;
     };
 
+    namespace detail
+    {
+        // A binary exponent is folded into the numerator or denominator for as long as it fits.
+        template <typename Ratio, bool Multiply = (Ratio::exp2 > 0 && Ratio::num <= std::numeric_limits<std::intmax_t>::max() / 2 && Ratio::num >= -std::numeric_limits<std::intmax_t>::max() / 2),
+            bool Divide = (Ratio::exp2 < 0 && Ratio::den <= std::numeric_limits<std::intmax_t>::max() / 2)>
+        struct fold_binary_exponent { using result_type = Ratio; };
+        template <typename Ratio, bool Divide>
+        struct fold_binary_exponent<Ratio, true, Divide> { using result_type = typename fold_binary_exponent<ratio<Ratio::num * 2, Ratio::den, Ratio::exp, Ratio::exp2 - 1, Ratio::exp_pi>>::result_type; };
+        template <typename Ratio>
+        struct fold_binary_exponent<Ratio, false, true> { using result_type = typename fold_binary_exponent<ratio<Ratio::num, Ratio::den * 2, Ratio::exp, Ratio::exp2 + 1, Ratio::exp_pi>>::result_type; };
+
+        template <typename Ratio, bool NumeratorDecimal = (Ratio::num != 0 && Ratio::num % 10 == 0), bool DenominatorDecimal = (Ratio::den % 10 == 0)>
+        struct normalize_ratio { using result_type = ratio<Ratio::num, Ratio::den, Ratio::exp, Ratio::exp2, Ratio::exp_pi>; };
+        template <typename Ratio, bool DenominatorDecimal>
+        struct normalize_ratio<Ratio, true, DenominatorDecimal> { using result_type = typename normalize_ratio<ratio<Ratio::num / 10, Ratio::den, Ratio::exp + 1, Ratio::exp2, Ratio::exp_pi>>::result_type; };
+        template <typename Ratio>
+        struct normalize_ratio<Ratio, false, true> { using result_type = typename normalize_ratio<ratio<Ratio::num, Ratio::den / 10, Ratio::exp - 1, Ratio::exp2, Ratio::exp_pi>>::result_type; };
+    }
+
+    /// Ratio with its binary exponent folded in and its decimal factors moved into the exponent so that equal values are the same type.
+    template <typename Ratio>
+    using normalize_ratio_t = typename detail::normalize_ratio<typename detail::fold_binary_exponent<Ratio>::result_type>::result_type;
+
+    /// Canonical alternative to ratios<...>: a single combined magnitude, the multiple of the unit with the same
+    /// exponents and the base ratio in every slot. Units with equal exponents and magnitude are the same type
+    /// however they were formed, e.g. canonical_t<si::newton> and canonical_t<decltype(1.0_kg * 1.0_m / (1.0_s * 1.0_s))>.
+    template <typename Ratio>
+    struct magnitude
+    {
+        using ratio_type = normalize_ratio_t<Ratio>;
+        using inverse_t = magnitude<normalize_ratio_t<ratio<ratio_type::den, ratio_type::num, -ratio_type::exp, -ratio_type::exp2, -ratio_type::exp_pi>>>;
+    };
+
+    template <typename Ratios>
+    constexpr bool is_magnitude_v = false;
+    template <typename Ratio>
+    constexpr bool is_magnitude_v<magnitude<Ratio>> = true;
+
+    namespace detail
+    {
+        template <typename Exponents, typename Ratios>
+        struct magnitude_of;
+        template <typename Exponents, typename Ratios>
+        using magnitude_of_t = typename magnitude_of<Exponents, Ratios>::result_type;
+    }
+
+    /// The type in which arithmetic on values of type T is carried out: T itself except for reduced precision
+    /// storage types (see float16.hpp), which widen.
+    template <typename T>
+    struct compute_type { using type = T; };
+    template <typename T>
+    using compute_type_t = typename compute_type<T>::type;
+
     template <typename Dimension, typename Exponents, typename Ratios>
     struct unit
     {
@@ -383,31 +469,35 @@ namespace neounit
         using exponents_type = typename unit_type::exponents_type;
         using ratios_type = typename unit_type::ratios_type;
     public:
-        scalar() : iValue{}
+        constexpr scalar() : iValue{}
         {
         }
         template <typename U = T>
-        scalar(U aValue, std::enable_if_t<std::is_same_v<std::decay_t<U>, T>, int> = {}) : iValue{ aValue }
+            requires std::is_same_v<std::decay_t<U>, T>
+        constexpr scalar(U aValue) : iValue{ aValue }
         {
         }
-        scalar(self_type const& aValue) : iValue{ aValue }
+        constexpr scalar(self_type const& aValue) = default;
+        /// Conversion between a unit and its canonical (single magnitude) form, which have the same value.
+        template <typename OtherRatios>
+            requires (is_magnitude_v<Ratios> != is_magnitude_v<OtherRatios>) && 
+                std::is_same_v<detail::magnitude_of_t<Exponents, Ratios>, detail::magnitude_of_t<Exponents, OtherRatios>>
+        constexpr scalar(scalar<T, Dimension, Exponents, OtherRatios> const& aValue) : iValue{ static_cast<T>(aValue) }
         {
         }
     public:
         template <typename U = T>
-        std::enable_if_t<std::is_same_v<std::decay_t<U>, value_type>, self_type>& operator=(U aValue)
-        {
-            iValue = aValue;
-            return *this;
-        }
-        self_type& operator=(self_type const& aValue)
+            requires std::is_same_v<std::decay_t<U>, value_type>
+        constexpr self_type& operator=(U aValue)
         {
             iValue = aValue;
             return *this;
         }
+        constexpr self_type& operator=(self_type const& aValue) = default;
     public:
         template <typename U = value_type>
-        constexpr operator std::enable_if_t<std::is_same_v<std::decay_t<U>, value_type>, value_type>() const
+            requires std::is_same_v<std::decay_t<U>, value_type>
+        constexpr operator value_type() const
         {
             return iValue;
         }
@@ -428,6 +518,24 @@ namespace neounit
         {
             return aLhs.iValue <=> aRhs.iValue;
         }
+        // Relational operators between quantities are provided directly rather than rewritten from
+        // operator<=> as a floating point partial_ordering costs an extra unordered test per comparison.
+        friend bool constexpr operator<(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue < aRhs.iValue;
+        }
+        friend bool constexpr operator<=(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue <= aRhs.iValue;
+        }
+        friend bool constexpr operator>(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue > aRhs.iValue;
+        }
+        friend bool constexpr operator>=(self_type const& aLhs, self_type const& aRhs)
+        {
+            return aLhs.iValue >= aRhs.iValue;
+        }
         friend auto constexpr operator==(self_type const& aLhs, value_type const& aRhs)
         {
             return aLhs.iValue == aRhs;
@@ -461,6 +569,28 @@ namespace neounit
                 return static_cast<T>(1.0);
         }
 
+        template <typename T, std::intmax_t Power>
+        inline constexpr T power_2()
+        {
+            if constexpr (Power < 0)
+                return static_cast<T>(0.5) * power_2<T, Power + 1>();
+            else if constexpr (Power > 0)
+                return static_cast<T>(2) * power_2<T, Power - 1>();
+            else
+                return static_cast<T>(1.0);
+        }
+
+        template <typename T, std::intmax_t Power>
+        inline constexpr T power_pi()
+        {
+            if constexpr (Power < 0)
+                return static_cast<T>(1.0) / power_pi<T, -Power>();
+            else if constexpr (Power > 0)
+                return std::numbers::pi_v<T> * power_pi<T, Power - 1>();
+            else
+                return static_cast<T>(1.0);
+        }
+
         template <typename T, dimensional_exponent LhsExponent, dimensional_exponent RhsExponent, typename LhsRatio, typename RhsRatio>
         inline constexpr T coefficient()
         {
@@ -470,9 +600,9 @@ namespace neounit
                 auto const num = calc::num;
                 auto const den = calc::den;
                 if constexpr (LhsExponent >= 0 || RhsExponent >= 0)
-                    return static_cast<T>(1.0) * num / den * power_10<T, calc::exp>();
+                    return static_cast<T>(1.0) * num / den * power_10<T, calc::exp>() * power_2<T, calc::exp2>() * power_pi<T, calc::exp_pi>();
                 else
-                    return static_cast<T>(1.0) / num * den * power_10<T, -calc::exp>();
+                    return static_cast<T>(1.0) / num * den * power_10<T, -calc::exp>() * power_2<T, -calc::exp2>() * power_pi<T, -calc::exp_pi>();
             }
             return static_cast<T>(1.0);
         };
@@ -482,17 +612,313 @@ namespace neounit
         {
             return (coefficient<T, LhsExponents, RhsExponents, LhsRatios, RhsRatios>() * ...);
         };
+
+        template <dimensional_exponent LhsExponent, dimensional_exponent RhsExponent, typename LhsRatio, typename RhsRatio>
+        struct coefficient_ratio
+        {
+            using calc = ratio_divide<apply_power_t<RhsRatio, RhsExponent>, apply_power_t<LhsRatio, LhsExponent>>;
+            using result_type = std::conditional_t<(LhsExponent >= 0 || RhsExponent >= 0), calc, ratio<calc::den, calc::num, -calc::exp, -calc::exp2, -calc::exp_pi>>;
+        };
+        template <dimensional_exponent LhsExponent, dimensional_exponent RhsExponent, typename RhsRatio>
+        struct coefficient_ratio<LhsExponent, RhsExponent, none, RhsRatio> { using result_type = one; };
+        template <dimensional_exponent LhsExponent, dimensional_exponent RhsExponent, typename LhsRatio>
+        struct coefficient_ratio<LhsExponent, RhsExponent, LhsRatio, none> { using result_type = one; };
+        template <dimensional_exponent LhsExponent, dimensional_exponent RhsExponent>
+        struct coefficient_ratio<LhsExponent, RhsExponent, none, none> { using result_type = one; };
+
+        template <typename... Ratios>
+        struct ratio_product { using result_type = one; };
+        template <typename First, typename... Rest>
+        struct ratio_product<First, Rest...> { using result_type = ratio_multiply<First, typename ratio_product<Rest...>::result_type>; };
+
+        template <typename Ratio>
+        using base_ratio_t = std::conditional_t<std::is_same_v<Ratio, none>, none, one>;
+
+        // Type level form of coefficient() for exact (integer) conversions; units with a single magnitude convert
+        // through the ratio of the magnitudes.
+        template <typename LhsExponents, typename RhsExponents, typename LhsRatios, typename RhsRatios>
+        struct conversion_ratio
+        {
+            using result_type = ratio_divide<magnitude_of_t<RhsExponents, RhsRatios>, magnitude_of_t<LhsExponents, LhsRatios>>;
+        };
+        template <dimensional_exponent... LhsExponents, dimensional_exponent... RhsExponents, typename... LhsRatios, typename... RhsRatios>
+        struct conversion_ratio<exponents<LhsExponents...>, exponents<RhsExponents...>, ratios<LhsRatios...>, ratios<RhsRatios...>>
+        {
+            using result_type = typename ratio_product<typename coefficient_ratio<LhsExponents, RhsExponents, LhsRatios, RhsRatios>::result_type...>::result_type;
+        };
+
+        template <dimensional_exponent... Exponents, typename... Ratios>
+        struct magnitude_of<exponents<Exponents...>, ratios<Ratios...>>
+        {
+            using result_type = normalize_ratio_t<typename conversion_ratio<exponents<Exponents...>, exponents<Exponents...>, ratios<base_ratio_t<Ratios>...>, ratios<Ratios...>>::result_type>;
+        };
+        template <typename Exponents, typename Ratio>
+        struct magnitude_of<Exponents, magnitude<Ratio>> { using result_type = typename magnitude<Ratio>::ratio_type; };
+
+        template <typename T, typename Ratio>
+        inline constexpr T ratio_value()
+        {
+            using compute = compute_type_t<T>;
+            return static_cast<T>(static_cast<compute>(1.0) * Ratio::num / Ratio::den * power_10<compute, Ratio::exp>() * power_2<compute, Ratio::exp2>() * power_pi<compute, Ratio::exp_pi>());
+        }
+
+        template <typename T, typename LhsExponents, typename RhsExponents, typename LhsRatios, typename RhsRatios>
+            requires (is_magnitude_v<LhsRatios> || is_magnitude_v<RhsRatios>)
+        inline constexpr T coefficient(LhsExponents, RhsExponents, LhsRatios, RhsRatios)
+        {
+            return ratio_value<T, typename conversion_ratio<LhsExponents, RhsExponents, LhsRatios, RhsRatios>::result_type>();
+        };
+
+        struct integral_scale
+        {
+            std::intmax_t multiplier;
+            std::intmax_t divisor;
+        };
+
+        // Ratio as a reduced integer multiplier and divisor; powers of two (IEC prefixes) stay powers of two
+        // so that scaling by them compiles to shifts.
+        template <typename Ratio>
+        consteval integral_scale integral_scale_of()
+        {
+            constexpr std::intmax_t maximum = std::numeric_limits<std::intmax_t>::max();
+            integral_scale result{ Ratio::num, Ratio::den };
+            auto scale = [&](std::intmax_t aExponent, std::intmax_t aBase)
+            {
+                auto& term = aExponent >= 0 ? result.multiplier : result.divisor;
+                for (auto e = aExponent >= 0 ? aExponent : -aExponent; e > 0; --e)
+                {
+                    if (term > maximum / aBase)
+                        throw std::overflow_error("neounit: integral conversion factor overflow");
+                    term *= aBase;
+                }
+            };
+            scale(Ratio::exp, 10);
+            scale(Ratio::exp2, 2);
+            auto const g = std::gcd(result.multiplier, result.divisor);
+            result.multiplier /= g;
+            result.divisor /= g;
+            return result;
+        }
+
+        // aValue * Ratio without going through floating point; a conversion to a coarser unit truncates
+        // towards zero (as integer division does).
+        template <typename Ratio, typename T>
+        inline constexpr T scale_integral(T aValue)
+        {
+            constexpr integral_scale scale = integral_scale_of<Ratio>();
+            if constexpr (scale.multiplier != 1)
+                aValue = static_cast<T>(aValue * static_cast<T>(scale.multiplier));
+            if constexpr (scale.divisor != 1)
+                aValue = static_cast<T>(aValue / static_cast<T>(scale.divisor));
+            return aValue;
+        }
+    }
+
+    namespace detail
+    {
+        template <typename To, typename T, typename Dimension, std::same_as<typename To::exponents_type> Exponents, typename Ratios>
+        constexpr inline To convert_scalar(scalar<T, Dimension, Exponents, Ratios> const& aRhs)
+        {
+            using rhs_type = std::decay_t<decltype(aRhs)>;
+            if constexpr (std::is_same_v<To, rhs_type>)
+                return aRhs;
+            auto result = static_cast<typename To::value_type>(static_cast<T>(aRhs));
+            if constexpr (std::is_integral_v<T> && std::is_integral_v<typename To::value_type>)
+            {
+                // powers of pi (angle units) have no integer scale
+                using conversion = typename conversion_ratio<typename To::exponents_type, Exponents, typename To::ratios_type, Ratios>::result_type;
+                if constexpr (conversion::exp_pi == 0)
+                    result = scale_integral<conversion>(static_cast<typename To::value_type>(result));
+                else
+                    result = static_cast<typename To::value_type>(result * ratio_value<compute_type_t<T>, conversion>());
+            }
+            else
+                result = static_cast<typename To::value_type>(
+                    result * coefficient<compute_type_t<T>>(typename To::exponents_type{}, Exponents{}, typename To::ratios_type{}, Ratios{}));
+            return result;
+        }
     }
 
     template <typename To, typename T, typename Dimension, std::same_as<typename To::exponents_type> Exponents, typename Ratios>
     constexpr inline To conversion_cast(scalar<T, Dimension, Exponents, Ratios> const& aRhs)
     {
-        using rhs_type = std::decay_t<decltype(aRhs)>;
-        if constexpr (std::is_same_v<To, rhs_type>)
-            return aRhs;
-        auto result = static_cast<typename To::value_type>(static_cast<T>(aRhs));
-        result = result * detail::coefficient<T>(typename To::exponents_type{}, Exponents{}, typename To::ratios_type{}, Ratios{});
-        return result;
+#ifdef NEOUNIT_INSTRUMENT_CONVERSIONS
+        if constexpr (!std::is_same_v<To, scalar<T, Dimension, Exponents, Ratios>>)
+            if (!std::is_constant_evaluated())
+                detail::record_conversion<scalar<T, Dimension, Exponents, Ratios>, To>(1u);
+#endif
+        return detail::convert_scalar<To>(aRhs);
+    }
+
+    namespace detail
+    {
+        struct decimal
+        {
+            std::intmax_t mantissa;
+            std::intmax_t exponent;
+        };
+
+        // Parses the characters of a numeric literal (integer literals in any base, decimal floating literals).
+        template <char... Chars>
+        consteval decimal parse_decimal()
+        {
+            constexpr char chars[] = { Chars... };
+            constexpr std::size_t count = sizeof...(Chars);
+            constexpr std::intmax_t maximum = std::numeric_limits<std::intmax_t>::max();
+            // a leading zero only makes an octal literal if the literal is not floating (e.g. 05.5 and 0e3 are decimal)
+            constexpr bool floating = ((Chars == '.' || Chars == 'e' || Chars == 'E') || ...);
+            std::size_t i = 0;
+            std::intmax_t base = 10;
+            if (count > 1 && chars[0] == '0')
+            {
+                if (chars[1] == 'x' || chars[1] == 'X')
+                    base = 16, i = 2;
+                else if (chars[1] == 'b' || chars[1] == 'B')
+                    base = 2, i = 2;
+                else if (!floating)
+                    base = 8, i = 1;
+            }
+            decimal result{ 0, 0 };
+            bool fraction = false;
+            for (; i < count; ++i)
+            {
+                char const c = chars[i];
+                if (c == '\'')
+                    continue;
+                if (c == '.' && base == 10)
+                {
+                    fraction = true;
+                    continue;
+                }
+                if ((c == 'e' || c == 'E') && base == 10)
+                {
+                    ++i;
+                    bool const negative = (i < count && chars[i] == '-');
+                    if (i < count && (chars[i] == '-' || chars[i] == '+'))
+                        ++i;
+                    std::intmax_t exponent = 0;
+                    for (; i < count; ++i)
+                        exponent = exponent * 10 + (chars[i] - '0');
+                    result.exponent += (negative ? -exponent : exponent);
+                    break;
+                }
+                if (base == 16 && (c == 'p' || c == 'P' || c == '.'))
+                    throw std::domain_error("neounit: hexadecimal floating literals are not supported");
+                std::intmax_t const digit = (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : c - 'A' + 10;
+                if (result.mantissa <= (maximum - digit) / base)
+                {
+                    result.mantissa = result.mantissa * base + digit;
+                    if (fraction)
+                        --result.exponent;
+                }
+                else if (digit == 0 && base == 10)
+                {
+                    if (!fraction)
+                        ++result.exponent;
+                }
+                else
+                    throw std::domain_error("neounit: too many significant digits for an exact literal");
+            }
+            return result;
+        }
+
+        // aMantissa * aNum / aDen * 10^aExponent * 2^aBinaryExponent rounded once to T; throws (at compile time) for
+        // integral T if the result is not an integer.
+        template <typename T>
+        consteval T exact_value(std::intmax_t aMantissa, std::intmax_t aNum, std::intmax_t aDen, std::intmax_t aExponent, std::intmax_t aBinaryExponent = 0)
+        {
+            constexpr std::intmax_t maximum = std::numeric_limits<std::intmax_t>::max();
+            auto const g1 = std::gcd(aMantissa, aDen);
+            if (g1 != 0)
+                aMantissa /= g1, aDen /= g1;
+            if (aMantissa != 0 && aNum > maximum / (aMantissa < 0 ? -aMantissa : aMantissa))
+                throw std::domain_error("neounit: exact literal conversion overflow");
+            aMantissa *= aNum;
+            while (aExponent > 0 && aMantissa <= maximum / 10 && aMantissa >= -maximum / 10)
+                aMantissa *= 10, --aExponent;
+            while (aExponent < 0 && aDen <= maximum / 10)
+                aDen *= 10, ++aExponent;
+            while (aBinaryExponent > 0 && aMantissa <= maximum / 2 && aMantissa >= -maximum / 2)
+                aMantissa *= 2, --aBinaryExponent;
+            while (aBinaryExponent < 0 && aDen <= maximum / 2)
+                aDen *= 2, ++aBinaryExponent;
+            auto const g2 = std::gcd(aMantissa, aDen);
+            if (g2 != 0)
+                aMantissa /= g2, aDen /= g2;
+            if constexpr (std::is_integral_v<T>)
+            {
+                if (aDen != 1 || aExponent < 0 || aBinaryExponent < 0)
+                    throw std::domain_error("neounit: literal is not exactly representable");
+                if (aExponent > 0 || aBinaryExponent > 0)
+                    throw std::domain_error("neounit: exact literal conversion overflow");
+                return static_cast<T>(aMantissa);
+            }
+            else
+            {
+                T result = static_cast<T>(aMantissa) / static_cast<T>(aDen);
+                for (; aExponent > 0; --aExponent)
+                    result *= static_cast<T>(10);
+                for (; aExponent < 0; ++aExponent)
+                    result /= static_cast<T>(10);
+                for (; aBinaryExponent > 0; --aBinaryExponent)
+                    result *= static_cast<T>(2);
+                for (; aBinaryExponent < 0; ++aBinaryExponent)
+                    result /= static_cast<T>(2);
+                return result;
+            }
+        }
+    }
+
+    /// The result of a literal operator from a literals::exact namespace: the decimal text of the literal is
+    /// kept as an exact integer mantissa and exponent and is only rounded when converted (at compile time)
+    /// to a scalar with the same dimensions, in any unit and with any value type, e.g. si::m<1, int>{ 0.1_km }
+    /// is exactly 100. A conversion that is not exact for an integral value type does not compile.
+    template <typename Unit>
+    class exact_literal
+    {
+    public:
+        using self_type = exact_literal<Unit>;
+        using unit_type = Unit;
+    public:
+        consteval exact_literal(detail::decimal const& aValue) : iValue{ aValue }
+        {
+        }
+    public:
+        consteval self_type operator+() const
+        {
+            return *this;
+        }
+        consteval self_type operator-() const
+        {
+            return detail::decimal{ -iValue.mantissa, iValue.exponent };
+        }
+        template <typename T, typename Dimension, typename Exponents, typename Ratios>
+        consteval operator scalar<T, Dimension, Exponents, Ratios>() const
+        {
+            static_assert(std::is_same_v<Dimension, typename unit_type::dimension_type> && std::is_same_v<Exponents, typename unit_type::exponents_type>, 
+                "neounit::exact_literal: incompatible dimensions");
+            using calc = typename detail::conversion_ratio<Exponents, typename unit_type::exponents_type, Ratios, typename unit_type::ratios_type>::result_type;
+            if constexpr (calc::exp_pi == 0)
+                return detail::exact_value<T>(iValue.mantissa, calc::num, calc::den, iValue.exponent + calc::exp, calc::exp2);
+            else if constexpr (std::is_floating_point_v<T>)
+                return detail::exact_value<T>(iValue.mantissa, calc::num, calc::den, iValue.exponent + calc::exp, calc::exp2) * detail::power_pi<T, calc::exp_pi>();
+            else
+                throw std::domain_error("neounit: literal is not exactly representable");
+        }
+    private:
+        detail::decimal iValue;
+    };
+
+    template <typename Unit, char... Chars>
+    consteval exact_literal<Unit> make_exact_literal()
+    {
+        return detail::parse_decimal<Chars...>();
+    }
+
+    template <typename To, typename Unit>
+    consteval To conversion_cast(exact_literal<Unit> const& aRhs)
+    {
+        return aRhs;
     }
 
     template <dimensional_exponent First, dimensional_exponent... Rest>
@@ -536,30 +962,52 @@ namespace neounit
     }
 
     template <typename T, typename Dimension, dimensional_exponent... LhsExponents, dimensional_exponent... RhsExponents, typename... LhsRatios, typename... RhsRatios>
-    constexpr inline std::enable_if_t<
-        !is_dimensionless_v<(LhsExponents + RhsExponents)...>, 
-        scalar<T, Dimension, exponents<(LhsExponents + RhsExponents)...>, ratios<typename combine_t<LhsExponents, RhsExponents, LhsRatios, RhsRatios>...>>> operator*(
+        requires (!is_dimensionless_v<(LhsExponents + RhsExponents)...>)
+    constexpr inline scalar<T, Dimension, exponents<(LhsExponents + RhsExponents)...>, ratios<combine_t<LhsExponents, RhsExponents, LhsRatios, RhsRatios>...>> operator*(
         scalar<T, Dimension, exponents<LhsExponents...>, ratios<LhsRatios...>> const& aLhs, scalar<T, Dimension, exponents<RhsExponents...>, ratios<RhsRatios...>> const& aRhs)
     {
         return static_cast<T>(aLhs) * static_cast<T>(aRhs);
     }
 
     template <typename T, typename Dimension, dimensional_exponent... LhsExponents, dimensional_exponent... RhsExponents, typename LhsRatios, typename RhsRatios>
-    constexpr inline std::enable_if_t<is_dimensionless_v<(LhsExponents + RhsExponents)...>, T> operator*(
+        requires is_dimensionless_v<(LhsExponents + RhsExponents)...> && (!is_magnitude_v<LhsRatios> && !is_magnitude_v<RhsRatios>)
+    constexpr inline T operator*(
         scalar<T, Dimension, exponents<LhsExponents...>, LhsRatios> const& aLhs, scalar<T, Dimension, exponents<RhsExponents...>, RhsRatios> const& aRhs)
     {
         return static_cast<T>(aLhs) * static_cast<T>(aRhs);
     }
 
+    // Products involving a canonical (single magnitude) unit multiply the magnitudes, so any two units combine
+    // without combine_t; a dimensionless result is a number and carries the combined magnitude.
+    template <typename T, typename Dimension, dimensional_exponent... LhsExponents, dimensional_exponent... RhsExponents, typename LhsRatios, typename RhsRatios>
+        requires (is_magnitude_v<LhsRatios> || is_magnitude_v<RhsRatios>)
+    constexpr inline auto operator*(
+        scalar<T, Dimension, exponents<LhsExponents...>, LhsRatios> const& aLhs, scalar<T, Dimension, exponents<RhsExponents...>, RhsRatios> const& aRhs)
+    {
+        using result_ratio = normalize_ratio_t<ratio_multiply<
+            detail::magnitude_of_t<exponents<LhsExponents...>, LhsRatios>, detail::magnitude_of_t<exponents<RhsExponents...>, RhsRatios>>>;
+        if constexpr (is_dimensionless_v<(LhsExponents + RhsExponents)...>)
+        {
+            if constexpr (std::is_same_v<result_ratio, one>)
+                return static_cast<T>(aLhs) * static_cast<T>(aRhs);
+            else
+                return static_cast<T>(aLhs) * static_cast<T>(aRhs) * detail::ratio_value<T, result_ratio>();
+        }
+        else
+            return scalar<T, Dimension, exponents<(LhsExponents + RhsExponents)...>, magnitude<result_ratio>>{ static_cast<T>(aLhs) * static_cast<T>(aRhs) };
+    }
+
     template <typename T, typename Dimension, dimensional_exponent... RhsExponents, typename RhsRatios>
-    constexpr inline std::enable_if_t<!is_dimensionless_v<(0 - RhsExponents)...>, scalar<T, Dimension, exponents<(0 - RhsExponents)...>, typename RhsRatios::inverse_t>> operator/(
+        requires (!is_dimensionless_v<(0 - RhsExponents)...>)
+    constexpr inline scalar<T, Dimension, exponents<(0 - RhsExponents)...>, typename RhsRatios::inverse_t> operator/(
         T const& aLhs, scalar<T, Dimension, exponents<RhsExponents...>, RhsRatios> const& aRhs)
     {
         return static_cast<T>(aLhs) / static_cast<T>(aRhs);
     }
 
     template <typename T, typename Dimension, dimensional_exponent... RhsExponents, typename RhsRatios>
-    constexpr inline std::enable_if_t<is_dimensionless_v<(0 - RhsExponents)...>, T> operator/(
+        requires is_dimensionless_v<(0 - RhsExponents)...>
+    constexpr inline T operator/(
         T const& aLhs, scalar<T, Dimension, exponents<RhsExponents...>, RhsRatios> const& aRhs)
     {
         return static_cast<T>(aLhs) / static_cast<T>(aRhs);
@@ -569,6 +1017,26 @@ namespace neounit
     constexpr inline auto operator/(
         scalar<T, Dimension, exponents<LhsExponents...>, LhsRatios> const& aLhs, scalar<T, Dimension, exponents<RhsExponents...>, RhsRatios> const& aRhs)
     {
-        return aLhs * (static_cast<T>(1.0) / aRhs);
+        using result_type = decltype(aLhs * (static_cast<T>(1.0) / aRhs));
+        if constexpr ((is_magnitude_v<LhsRatios> || is_magnitude_v<RhsRatios>) && std::is_same_v<result_type, T>)
+        {
+            using result_ratio = ratio_divide<detail::magnitude_of_t<exponents<LhsExponents...>, LhsRatios>, detail::magnitude_of_t<exponents<RhsExponents...>, RhsRatios>>;
+            return static_cast<T>(aLhs) / static_cast<T>(aRhs) * detail::ratio_value<T, result_ratio>();
+        }
+        else
+            return result_type{ static_cast<T>(aLhs) / static_cast<T>(aRhs) };
+    }
+
+    /// The canonical (single magnitude) form of a unit: the same unit as Scalar, and the same type for every unit
+    /// equal to it. Products of units keep a ratio per base unit (combine_t), so e.g. km * ms and m * s are distinct
+    /// types and so is every function instantiated for them; products of canonical units are one type per magnitude.
+    template <typename Scalar>
+    using canonical_t = scalar<typename Scalar::value_type, typename Scalar::dimension_type, typename Scalar::exponents_type,
+        magnitude<detail::magnitude_of_t<typename Scalar::exponents_type, typename Scalar::ratios_type>>>;
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    constexpr inline canonical_t<scalar<T, Dimension, Exponents, Ratios>> canonical(scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        return static_cast<T>(aValue);
     }
 }
\ No newline at end of file
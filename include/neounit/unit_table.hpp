@@ -0,0 +1,226 @@
+// unit_table.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <neounit/unit.hpp>
+#include <neounit/si.hpp>
+#include <neounit/si_derived.hpp>
+#include <neounit/si_other.hpp>
+#include <neounit/information.hpp>
+#include <neounit/imperial.hpp>
+#include <neounit/astronomical.hpp>
+#include <neounit/descriptor.hpp>
+
+namespace neounit
+{
+    // Dense integer IDs for units only known at runtime (from configuration or file headers), e.g.
+    //
+    //     auto const from = named_unit_table::id_of(read_descriptor(header, position));
+    //     auto const factor = named_unit_table::factor(from, named_unit_table::id_of<si::metre>());   // two loads, one multiply
+    //     named_unit_table::visit(from, [&](auto aUnit) { kernel<decltype(aUnit)>(samples); });
+    //
+    // A unit_table numbers its units in the order given and holds, per unit, its descriptor and the factors to
+    // and from the base units of its dimension, computed at compile time; the factor between two units is the
+    // product of one of each, rounded once more than the coefficient conversion_cast folds. visit dispatches
+    // to the visitor instantiated for each unit. IDs depend on the order of the units so they are not a storage
+    // format; store descriptors and look IDs up when reading them.
+
+    namespace detail
+    {
+        template <std::size_t Size>
+        constexpr std::array<double, Size> base_factors(std::array<unit_descriptor, Size> const& aDescriptors, bool aToBase)
+        {
+            std::array<double, Size> result = {};
+            for (std::size_t id = 0; id < Size; ++id)
+            {
+                unit_descriptor const base = { aDescriptors[id].exponents, 1, 1, 0, 0, 0 };
+                result[id] = aToBase ? conversion_factor(aDescriptors[id], base) : conversion_factor(base, aDescriptors[id]);
+            }
+            return result;
+        }
+    }
+
+    template <typename... Units>
+    struct unit_table
+    {
+        static_assert(sizeof...(Units) != 0u && sizeof...(Units) <= std::numeric_limits<std::uint16_t>::max(), "neounit::unit_table: unsupported number of units");
+
+        using id_type = std::uint16_t;
+        static constexpr std::size_t size = sizeof...(Units);
+
+        static constexpr std::array<unit_descriptor, size> descriptors = { descriptor_of<Units>()... };
+        /// Factors by which a value in each unit is multiplied to give the value in base units, and back.
+        static constexpr std::array<double, size> to_base = detail::base_factors(descriptors, true);
+        static constexpr std::array<double, size> from_base = detail::base_factors(descriptors, false);
+
+        /// The ID of the first unit with aDescriptor's dimensions and magnitude; throws std::invalid_argument if
+        /// there is none.
+        static constexpr id_type id_of(unit_descriptor const& aDescriptor)
+        {
+            for (std::size_t id = 0; id < size; ++id)
+                if (descriptors[id] == aDescriptor)
+                    return static_cast<id_type>(id);
+            throw std::invalid_argument("neounit::unit_table: unknown unit");
+        }
+
+        /// The ID of Unit (or of the first unit equal to it, e.g. hertz for becquerel).
+        template <typename Unit>
+        static constexpr id_type id_of()
+        {
+            constexpr auto descriptor = descriptor_of<Unit>();
+            static_assert(contains(descriptor), "neounit::unit_table: unit not in table");
+            return id_of(descriptor);
+        }
+
+        static constexpr bool contains(unit_descriptor const& aDescriptor)
+        {
+            for (auto const& descriptor : descriptors)
+                if (descriptor == aDescriptor)
+                    return true;
+            return false;
+        }
+
+        /// The factor by which a value in aFrom is multiplied to give the same quantity in aTo; throws
+        /// std::invalid_argument if either ID is out of range or the dimensions differ.
+        template <typename T = double>
+        static constexpr T factor(id_type aFrom, id_type aTo)
+        {
+            if (aFrom >= size || aTo >= size)
+                throw std::invalid_argument("neounit::unit_table: unknown unit id");
+            if (!descriptors[aFrom].same_dimensions(descriptors[aTo]))
+                throw std::invalid_argument("neounit::unit_table: incompatible dimensions");
+            if (aFrom == aTo)
+                return static_cast<T>(1.0);
+            return static_cast<T>(to_base[aFrom] * from_base[aTo]);
+        }
+
+        /// Converts raw values in aFrom to raw values in aTo, one multiply per element.
+        template <typename T>
+        static void convert(std::span<T const> aInput, id_type aFrom, id_type aTo, std::span<T> aOutput)
+        {
+            static_assert(std::is_floating_point_v<T>, "neounit::unit_table: value type must be floating point");
+            if (aInput.size() != aOutput.size())
+                throw std::invalid_argument("neounit::unit_table: size mismatch");
+            auto const multiplier = factor<T>(aFrom, aTo);
+            for (std::size_t i = 0; i < aInput.size(); ++i)
+                aOutput[i] = aInput[i] * multiplier;
+        }
+
+        /// Calls aVisitor with a (zero) value of the unit aId, so that it can be instantiated for the static
+        /// type, and returns its result by value; the visitor must return the same type for every unit. Throws
+        /// std::invalid_argument if aId is out of range.
+        template <typename Visitor>
+        static auto visit(id_type aId, Visitor&& aVisitor)
+        {
+            if (aId >= size)
+                throw std::invalid_argument("neounit::unit_table: unknown unit id");
+            return visit_id(aId, aVisitor, std::index_sequence_for<Units...>{});
+        }
+
+    private:
+        // a chain of comparisons rather than an array of function pointers: compilers turn it into a jump
+        // table, and instantiate it much faster for large tables
+        template <typename Visitor, std::size_t... Ids>
+        static auto visit_id(id_type aId, Visitor& aVisitor, std::index_sequence<Ids...>)
+        {
+            using result_type = std::remove_cvref_t<std::invoke_result_t<Visitor&, std::tuple_element_t<0u, std::tuple<Units...>>>>;
+            static_assert((std::is_same_v<result_type, std::remove_cvref_t<std::invoke_result_t<Visitor&, Units>>> && ...), "neounit::unit_table::visit: visitor must return the same type for every unit");
+            if constexpr (std::is_void_v<result_type>)
+                static_cast<void>(((aId == Ids && (aVisitor(Units{}), true)) || ...));
+            else
+            {
+                std::optional<result_type> result;
+                static_cast<void>(((aId == Ids && (result.emplace(aVisitor(Units{})), true)) || ...));
+                return *std::move(result);
+            }
+        }
+    };
+
+    // The first power of every named unit in si, si_derived, si_other, information, imperial and astronomical,
+    // unprefixed and with each prefix those headers define. Squares and inverses are left to tables of their own.
+
+    #define neounit_table_prefixes(Units) \
+    Units(q), Units(r), Units(y), Units(z), Units(a), Units(f), Units(p), Units(n), Units(u), Units(m), Units(c), Units(d), \
+    Units(da), Units(h), Units(k), Units(M), Units(G), Units(T), Units(P), Units(E), Units(Z), Units(Y), Units(R), Units(Q)
+    #define neounit_table_si(ShortPrefix) \
+    si::ShortPrefix ## s<1>, si::ShortPrefix ## m<1>, si::ShortPrefix ## g<1>, si::ShortPrefix ## A<1>, si::ShortPrefix ## K<1>, si::ShortPrefix ## mol<1>, si::ShortPrefix ## cd<1>
+    #define neounit_table_si_derived(ShortPrefix) \
+    si::ShortPrefix ## Hz, si::ShortPrefix ## rad, si::ShortPrefix ## N, si::ShortPrefix ## Pa, si::ShortPrefix ## J, si::ShortPrefix ## W, si::ShortPrefix ## C, \
+    si::ShortPrefix ## V, si::ShortPrefix ## F, si::ShortPrefix ## Ω, si::ShortPrefix ## S, si::ShortPrefix ## Wb, si::ShortPrefix ## T, si::ShortPrefix ## H, \
+    si::ShortPrefix ## degC, si::ShortPrefix ## lm, si::ShortPrefix ## lx, si::ShortPrefix ## Bq, si::ShortPrefix ## Gy, si::ShortPrefix ## Sv, si::ShortPrefix ## kat
+    #define neounit_table_si_other(ShortPrefix) \
+    si::ShortPrefix ## hour, si::ShortPrefix ## t, si::ShortPrefix ## arcsec
+    #define neounit_table_information(ShortPrefix) \
+    si::ShortPrefix ## B<>, si::ShortPrefix ## b<>
+    #define neounit_table_imperial(ShortPrefix) \
+    imperial::ShortPrefix ## in<1>, imperial::ShortPrefix ## ft<1>, imperial::ShortPrefix ## yd<1>, imperial::ShortPrefix ## mi<1>, \
+    imperial::ShortPrefix ## gr<1>, imperial::ShortPrefix ## dr<1>, imperial::ShortPrefix ## oz<1>, imperial::ShortPrefix ## lb<1>, \
+    imperial::ShortPrefix ## st<1>, imperial::ShortPrefix ## qr<1>, imperial::ShortPrefix ## cwt<1>, imperial::ShortPrefix ## t_<1>
+    #define neounit_table_astronomical(ShortPrefix) \
+    astronomical::ShortPrefix ## pc<1>, astronomical::ShortPrefix ## au<1>, astronomical::ShortPrefix ## ly<1>
+
+    using named_unit_table = unit_table<
+        neounit_table_si(), neounit_table_prefixes(neounit_table_si),
+        si::Hz<>, si::rad<>, si::sr<>, si::N<>, si::Pa<>, si::J<>, si::W<>, si::C<>, si::V<>, si::F<>, si::Ω<>, si::S<>, si::Wb<>, si::T<>, si::H<>,
+        si::degC<>, si::lm<>, si::lx<>, si::Bq<>, si::Gy<>, si::Sv<>, si::kat<>, neounit_table_prefixes(neounit_table_si_derived),
+        si::h<>, si::t<>, si::deg<>, si::arcmin<>, si::arcsec<>, si::tr<>, neounit_table_prefixes(neounit_table_si_other),
+        neounit_table_information(), neounit_table_information(k), neounit_table_information(M), neounit_table_information(G),
+        neounit_table_information(T), neounit_table_information(P), neounit_table_information(E), neounit_table_information(Z),
+        neounit_table_information(Y), neounit_table_information(Ki), neounit_table_information(Mi), neounit_table_information(Gi),
+        neounit_table_information(Ti), neounit_table_information(Pi), neounit_table_information(Ei), neounit_table_information(Zi),
+        neounit_table_information(Yi),
+        neounit_table_imperial(), neounit_table_prefixes(neounit_table_imperial),
+        neounit_table_astronomical(), neounit_table_prefixes(neounit_table_astronomical)>;
+
+    #undef neounit_table_prefixes
+    #undef neounit_table_si
+    #undef neounit_table_si_derived
+    #undef neounit_table_si_other
+    #undef neounit_table_information
+    #undef neounit_table_imperial
+    #undef neounit_table_astronomical
+}
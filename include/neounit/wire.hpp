@@ -0,0 +1,308 @@
+// wire.hpp
+/*
+ *  Copyright (c) 2023 Leigh Johnston.
+ *
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of Leigh Johnston nor the names of any
+ *       other contributors to this software may be used to endorse or
+ *       promote products derived from this software without specific prior
+ *       written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ *  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ *  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ *  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include <neounit/unit.hpp>
+#include <neounit/descriptor.hpp>
+
+namespace neounit
+{
+    // Binary wire format for columns of quantities. A column is a fixed 48 byte little-endian header followed by
+    // the values, little-endian and padded to a multiple of 8 bytes so that consecutive columns stay aligned:
+    //
+    //     offset  size
+    //          0     2  "NQ"
+    //          2     1  version (1)
+    //          3     1  value kind (see value_kind_of)
+    //          4     9  dimensional exponents (int8)
+    //         16     8  magnitude numerator (int64)
+    //         24     8  magnitude denominator (int64)
+    //         32     2  magnitude decimal exponent (int16)
+    //         34     2  magnitude binary exponent (int16)
+    //         36     2  magnitude pi exponent (int16)
+    //         40     8  number of values (uint64)
+    //         48        values
+    //
+    // Other header bytes are zero. A single value is a column of one and a message is a sequence of columns.
+    // Values are read in place through a wire_view, converted if the column is in a different multiple of the
+    // same unit.
+
+    namespace detail
+    {
+        constexpr std::byte wire_magic[] = { std::byte{ 'N' }, std::byte{ 'Q' } };
+        constexpr std::uint8_t wire_version = 1u;
+        constexpr std::size_t wire_header_size = 48u;
+
+        template <typename T>
+        inline T load_le(std::byte const* aInput)
+        {
+            std::array<std::byte, sizeof(T)> bytes;
+            std::memcpy(bytes.data(), aInput, sizeof(T));
+            if constexpr (std::endian::native == std::endian::big)
+                std::reverse(bytes.begin(), bytes.end());
+            return std::bit_cast<T>(bytes);
+        }
+
+        template <typename T>
+        inline void store_le(std::byte* aOutput, T aValue)
+        {
+            auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(aValue);
+            if constexpr (std::endian::native == std::endian::big)
+                std::reverse(bytes.begin(), bytes.end());
+            std::memcpy(aOutput, bytes.data(), sizeof(T));
+        }
+
+        constexpr std::size_t wire_padded(std::size_t aBytes)
+        {
+            return (aBytes + 7u) / 8u * 8u;
+        }
+    }
+
+    struct wire_column_header
+    {
+        unit_descriptor unit;
+        std::uint8_t valueKind;
+        std::uint64_t count;
+
+        /// Bytes taken by the column including its header and padding.
+        std::size_t size() const
+        {
+            return detail::wire_header_size + detail::wire_padded(static_cast<std::size_t>(count) * (valueKind & 0x0Fu));
+        }
+    };
+
+    /// Reads and validates the header of the column starting at aPosition; throws std::invalid_argument if it is
+    /// not a column or the input is shorter than the column.
+    inline wire_column_header read_column_header(std::span<std::byte const> aInput, std::size_t aPosition)
+    {
+        if (aPosition > aInput.size() || aInput.size() - aPosition < detail::wire_header_size)
+            throw std::invalid_argument("neounit::read_column_header: truncated input");
+        auto const header = aInput.data() + aPosition;
+        if (header[0] != detail::wire_magic[0] || header[1] != detail::wire_magic[1])
+            throw std::invalid_argument("neounit::read_column_header: not a column");
+        if (header[2] != std::byte{ detail::wire_version })
+            throw std::invalid_argument("neounit::read_column_header: unsupported version");
+        wire_column_header result{};
+        result.valueKind = static_cast<std::uint8_t>(header[3]);
+        auto const valueSize = result.valueKind & 0x0Fu;
+        if (valueSize != 1u && valueSize != 2u && valueSize != 4u && valueSize != 8u)
+            throw std::invalid_argument("neounit::read_column_header: unknown value kind");
+        for (std::size_t i = 0; i < result.unit.exponents.size(); ++i)
+            result.unit.exponents[i] = static_cast<std::int8_t>(header[4 + i]);
+        result.unit.num = detail::load_le<std::int64_t>(header + 16);
+        result.unit.den = detail::load_le<std::int64_t>(header + 24);
+        result.unit.exp = detail::load_le<std::int16_t>(header + 32);
+        result.unit.exp2 = detail::load_le<std::int16_t>(header + 34);
+        result.unit.exp_pi = detail::load_le<std::int16_t>(header + 36);
+        result.count = detail::load_le<std::uint64_t>(header + 40);
+        if (result.unit.num <= 0 || result.unit.den <= 0)
+            throw std::invalid_argument("neounit::read_column_header: malformed descriptor");
+        if (result.count > (aInput.size() - aPosition - detail::wire_header_size) / valueSize)
+            throw std::invalid_argument("neounit::read_column_header: truncated input");
+        return result;
+    }
+
+    template <typename Quantity, std::size_t Extent>
+    inline void write_column(std::vector<std::byte>& aOutput, std::span<Quantity const, Extent> aValues)
+    {
+        using value_type = typename Quantity::value_type;
+        static_assert(std::is_arithmetic_v<value_type> && sizeof(Quantity) == sizeof(value_type), "neounit::write_column: unsupported value type");
+        constexpr unit_descriptor unit = descriptor_of<Quantity>();
+        auto const start = aOutput.size();
+        auto const valueBytes = aValues.size() * sizeof(value_type);
+        aOutput.resize(start + detail::wire_header_size + detail::wire_padded(valueBytes), std::byte{ 0u });
+        auto const header = aOutput.data() + start;
+        header[0] = detail::wire_magic[0];
+        header[1] = detail::wire_magic[1];
+        header[2] = std::byte{ detail::wire_version };
+        header[3] = std::byte{ value_kind_of<value_type>() };
+        for (std::size_t i = 0; i < unit.exponents.size(); ++i)
+            header[4 + i] = static_cast<std::byte>(unit.exponents[i]);
+        detail::store_le(header + 16, unit.num);
+        detail::store_le(header + 24, unit.den);
+        detail::store_le(header + 32, unit.exp);
+        detail::store_le(header + 34, unit.exp2);
+        detail::store_le(header + 36, unit.exp_pi);
+        detail::store_le(header + 40, static_cast<std::uint64_t>(aValues.size()));
+        auto const values = header + detail::wire_header_size;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            if (valueBytes != 0u)
+                std::memcpy(values, aValues.data(), valueBytes);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < aValues.size(); ++i)
+                detail::store_le(values + i * sizeof(value_type), static_cast<value_type>(aValues[i]));
+        }
+    }
+
+    template <typename Quantity, std::size_t Extent>
+    inline void write_column(std::vector<std::byte>& aOutput, std::span<Quantity, Extent> aValues)
+    {
+        write_column(aOutput, std::span<Quantity const, Extent>{ aValues });
+    }
+
+    template <typename T, typename Dimension, typename Exponents, typename Ratios>
+    inline void write_value(std::vector<std::byte>& aOutput, scalar<T, Dimension, Exponents, Ratios> const& aValue)
+    {
+        write_column(aOutput, std::span<scalar<T, Dimension, Exponents, Ratios> const, 1>{ &aValue, 1u });
+    }
+
+    /// A column read in place as values of Quantity. If Sent is void the column may be in any multiple of the
+    /// unit of Quantity (with the same value type): the dimensions are checked when the view is opened and values
+    /// are scaled by a factor computed then; integral values are scaled by an integer multiplier and divisor as
+    /// conversion_cast does, so the column must not differ from Quantity by a power of pi. If Sent is the type the column was written as, the dimensions are
+    /// checked at compile time, the conversion from Sent to Quantity is folded at compile time and the view only
+    /// checks that the column holds Sent. Either constructor throws std::invalid_argument on a mismatch.
+    template <typename Quantity, typename Sent = void>
+    class wire_view
+    {
+    public:
+        using quantity_type = Quantity;
+        using value_type = typename quantity_type::value_type;
+        using sent_type = std::conditional_t<std::is_void_v<Sent>, quantity_type, Sent>;
+        using sent_value_type = typename sent_type::value_type;
+        static_assert(std::is_same_v<typename sent_type::dimension_type, typename quantity_type::dimension_type> &&
+            std::is_same_v<typename sent_type::exponents_type, typename quantity_type::exponents_type>, "neounit::wire_view: incompatible dimensions");
+    public:
+        explicit wire_view(std::span<std::byte const> aInput) : wire_view{ aInput, 0u, read_column_header(aInput, 0u) }
+        {
+        }
+        /// Opens the column at aPosition and advances aPosition to the next column.
+        wire_view(std::span<std::byte const> aInput, std::size_t& aPosition) : wire_view{ aInput, aPosition, read_column_header(aInput, aPosition) }
+        {
+            aPosition += iHeader.size();
+        }
+    private:
+        wire_view(std::span<std::byte const> aInput, std::size_t aPosition, wire_column_header const& aHeader) :
+            iHeader{ aHeader }, iValues{ aInput.data() + aPosition + detail::wire_header_size }, iFactor{ static_cast<value_type>(1) }, iScale{ 1, 1 }
+        {
+            if (iHeader.valueKind != value_kind_of<sent_value_type>())
+                throw std::invalid_argument("neounit::wire_view: value type mismatch");
+            constexpr unit_descriptor expected = descriptor_of<sent_type>();
+            if constexpr (!std::is_void_v<Sent>)
+            {
+                if (iHeader.unit != expected)
+                    throw std::invalid_argument("neounit::wire_view: unit mismatch");
+            }
+            else if (iHeader.unit != expected)
+            {
+                if (!iHeader.unit.same_dimensions(expected))
+                    throw std::invalid_argument("neounit::wire_view: incompatible dimensions");
+                if constexpr (std::is_integral_v<value_type>)
+                    iScale = integral_conversion_scale(iHeader.unit, expected);
+                else
+                    iFactor = conversion_factor<value_type>(iHeader.unit, expected);
+            }
+        }
+    public:
+        unit_descriptor const& unit() const
+        {
+            return iHeader.unit;
+        }
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(iHeader.count);
+        }
+        bool empty() const
+        {
+            return iHeader.count == 0u;
+        }
+        /// True if values are converted as they are read.
+        bool converts() const
+        {
+            if constexpr (std::is_void_v<Sent>)
+                return iFactor != static_cast<value_type>(1.0) || iScale.multiplier != 1 || iScale.divisor != 1;
+            else
+                return !std::is_same_v<Sent, Quantity>;
+        }
+        quantity_type operator[](std::size_t aIndex) const
+        {
+            auto const raw = detail::load_le<sent_value_type>(iValues + aIndex * sizeof(sent_value_type));
+            if constexpr (std::is_void_v<Sent>)
+            {
+                if constexpr (std::is_floating_point_v<value_type>)
+                    return raw * iFactor;
+                else
+                    return static_cast<value_type>(raw * static_cast<value_type>(iScale.multiplier) / static_cast<value_type>(iScale.divisor));
+            }
+            else
+                return conversion_cast<quantity_type>(sent_type{ raw });
+        }
+        /// Reads the whole column into aOutput, which must be at least size() values; a copy of the bytes when no
+        /// conversion is needed.
+        template <std::size_t Extent>
+        void copy_to(std::span<quantity_type, Extent> aOutput) const
+        {
+            if (aOutput.size() < size())
+                throw std::invalid_argument("neounit::wire_view: output too small");
+            auto const output = aOutput.data();
+            if (std::endian::native == std::endian::little && !converts())
+            {
+                if (size() != 0u)
+                    std::memcpy(output, iValues, size() * sizeof(value_type));
+            }
+            else
+            {
+                for (std::size_t i = 0; i < size(); ++i)
+                    output[i] = (*this)[i];
+            }
+        }
+        std::vector<quantity_type> to_vector() const
+        {
+            std::vector<quantity_type> result(size());
+            copy_to(std::span{ result });
+            return result;
+        }
+    private:
+        wire_column_header iHeader;
+        std::byte const* iValues;
+        value_type iFactor;
+        detail::integral_scale iScale;
+    };
+}
@@ -0,0 +1,68 @@
+#!/bin/sh
+# check_codegen.sh : compile kernels.cpp at each optimization level, disassemble each quantity_X / raw_X pair
+# with objdump, normalize the listings and fail if the instruction streams of any pair differ.
+#
+# usage: check_codegen.sh [compiler (default c++)] [extra compiler flags...]
+# Optimization levels checked can be overridden with NEOUNIT_CODEGEN_LEVELS (default "-O2 -O3"). Pairs that
+# differ only in instruction order or register allocation pass; set NEOUNIT_CODEGEN_STRICT to require
+# identical instruction streams.
+
+here=$(cd "$(dirname "$0")" && pwd)
+compiler=${1:-c++}
+[ $# -gt 0 ] && shift
+levels=${NEOUNIT_CODEGEN_LEVELS:-"-O2 -O3"}
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+kernels=$(sed -n 's|^ *// kernel \([a-z_0-9]*\):.*|\1|p' "$here/kernels.cpp")
+failures=0
+
+# Keep only the instruction mnemonics and operands of one function; addresses, encodings, alignment
+# padding and the targets of branches and calls (which are relative to the function itself) are dropped.
+disassemble()
+{
+    objdump -d --no-show-raw-insn --disassemble="$2" "$1" |
+        sed -n 's/^ *[0-9a-f]*:[[:space:]]*//p' |
+        sed 's/[[:space:]]*#.*$//; s/[[:space:]]\{1,\}/ /g; s/ *$//; /^\(data16 \|cs \)*nop/d' |
+        sed 's/^\(j[a-z]*\|call[a-z]*\|bnd jmp\) .*/\1 TARGET/'
+}
+
+# The same instructions with registers renamed and in any order: a pair that matches only in this form
+# has the same instructions, register moves included, but differs in scheduling or register allocation.
+canonical()
+{
+    sed 's/%[a-z0-9]*/REG/g' "$1" | sort
+}
+
+for level in $levels
+do
+    object="$work/kernels$level.o"
+    if ! "$compiler" -std=c++20 $level -I"$here/../../include" "$@" -c "$here/kernels.cpp" -o "$object"
+    then
+        echo "codegen: failed to compile kernels.cpp at $level"
+        exit 2
+    fi
+    for kernel in $kernels
+    do
+        disassemble "$object" "quantity_$kernel" > "$work/quantity"
+        disassemble "$object" "raw_$kernel" > "$work/raw"
+        if [ ! -s "$work/quantity" ] || [ ! -s "$work/raw" ]
+        then
+            echo "codegen: $level $kernel: kernel missing from object file"
+            failures=$((failures + 1))
+        elif cmp -s "$work/quantity" "$work/raw"
+        then
+            echo "codegen: $level $kernel: identical ($(wc -l < "$work/raw") instructions)"
+        elif [ -z "$NEOUNIT_CODEGEN_STRICT" ] && [ "$(canonical "$work/quantity")" = "$(canonical "$work/raw")" ]
+        then
+            echo "codegen: $level $kernel: equivalent ($(wc -l < "$work/raw") instructions; scheduling or register allocation differs)"
+        else
+            construct=$(sed -n "s|^ *// kernel $kernel: *||p" "$here/kernels.cpp")
+            echo "codegen: $level $kernel: DIFFERS; construct: $construct"
+            diff "$work/quantity" "$work/raw" | sed 's/^/    /'
+            failures=$((failures + 1))
+        fi
+    done
+done
+
+[ $failures -eq 0 ] || { echo "codegen: $failures divergent kernel(s)"; exit 1; }
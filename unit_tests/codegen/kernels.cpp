@@ -0,0 +1,232 @@
+// kernels.cpp : Codegen equivalence kernels; each quantity_X function must compile to the same machine code as raw_X.
+//
+// Every pair is preceded by a "// kernel <name>: <construct>" line naming the neounit construct it exercises;
+// check_codegen.sh uses it to attribute any divergence it finds.
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <neounit/neounit.hpp>
+#include <neounit/imperial.hpp>
+#include <neounit/math.hpp>
+#include <neounit/expression.hpp>
+#include <neounit/mdspan.hpp>
+#include <neounit/record.hpp>
+#include <neounit/constants.hpp>
+#include <neounit/information.hpp>
+#include <neounit/atomic.hpp>
+
+using namespace neounit;
+using namespace neounit::si;
+
+using speed = decltype(metre{} / second{});
+
+struct imperial_record { imperial::foot altitude; decltype(imperial::mile{} / hour{}) velocity; imperial::pound mass; };
+struct si_record { metre altitude; speed velocity; kilogram mass; };
+struct raw_record { double altitude; double velocity; double mass; };
+using energy = decltype(newton{} * metre{});
+
+extern "C"
+{
+    // kernel copy: scalar copy constructor and copy assignment (must be trivial)
+    void quantity_copy(metre* aResult, metre const* aInput, std::size_t aCount)
+    {
+        std::copy(aInput, aInput + aCount, aResult);
+    }
+    void raw_copy(double* aResult, double const* aInput, std::size_t aCount)
+    {
+        std::copy(aInput, aInput + aCount, aResult);
+    }
+
+    // kernel add: scalar operator+ and operator- (same unit)
+    void quantity_add(metre* aResult, metre const* aX, metre const* aY, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aX[i] + aY[i] - aX[i];
+    }
+    void raw_add(double* aResult, double const* aX, double const* aY, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aX[i] + aY[i] - aX[i];
+    }
+
+    // kernel scale: scalar operator* and operator/ with value_type
+    void quantity_scale(metre* aResult, metre const* aX, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aX[i] * 2.5 / 4.0;
+    }
+    void raw_scale(double* aResult, double const* aX, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aX[i] * 2.5 / 4.0;
+    }
+
+    // The multiply, divide and lazy_chain kernels take a __restrict result pointer: without it GCC versions the
+    // loops with runtime overlap checks whose order follows the pointee types, which is not what is compared.
+
+    // kernel multiply: dimension changing operator* (combine_t ratio unification)
+    void quantity_multiply(energy* __restrict aResult, newton const* aForce, metre const* aDistance, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aForce[i] * aDistance[i];
+    }
+    void raw_multiply(double* __restrict aResult, double const* aForce, double const* aDistance, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aForce[i] * aDistance[i];
+    }
+
+    // kernel divide: dimension changing operator/ (apply_inverse_t of the divisor's ratios)
+    void quantity_divide(speed* __restrict aResult, metre const* aDistance, second const* aTime, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aDistance[i] / aTime[i];
+    }
+    void raw_divide(double* __restrict aResult, double const* aDistance, double const* aTime, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aDistance[i] / aTime[i];
+    }
+
+    // kernel prefix_cast: conversion_cast between SI prefixes (detail::coefficient folded to a constant)
+    void quantity_prefix_cast(metre* aResult, kilometre const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = conversion_cast<metre>(aInput[i]);
+    }
+    void raw_prefix_cast(double* aResult, double const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aInput[i] * 1000.0;
+    }
+
+    // kernel imperial_cast: conversion_cast from imperial to SI (non-decimal ratio folded to a constant)
+    void quantity_imperial_cast(metre* aResult, imperial::foot const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = conversion_cast<metre>(aInput[i]);
+    }
+    void raw_imperial_cast(double* aResult, double const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aInput[i] * 0.3048;
+    }
+
+    // kernel compare: scalar relational operators
+    std::size_t quantity_compare(metre const* aX, metre const* aY, std::size_t aCount)
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+            result += (aX[i] < aY[i]) ? 1u : 0u;
+        return result;
+    }
+    std::size_t raw_compare(double const* aX, double const* aY, std::size_t aCount)
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+            result += (aX[i] < aY[i]) ? 1u : 0u;
+        return result;
+    }
+
+    // kernel sum: accumulation into a by-value quantity (scalar stays in a register)
+    double quantity_sum(metre const* aX, std::size_t aCount)
+    {
+        metre result;
+        for (std::size_t i = 0; i < aCount; ++i)
+            result = result + aX[i];
+        return static_cast<double>(result);
+    }
+    double raw_sum(double const* aX, std::size_t aCount)
+    {
+        double result{};
+        for (std::size_t i = 0; i < aCount; ++i)
+            result = result + aX[i];
+        return result;
+    }
+
+    // kernel hypot: neounit::sqrt over a dimension changing product
+    void quantity_hypot(metre* aResult, metre const* aX, metre const* aY, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = neounit::sqrt(aX[i] * aX[i] + aY[i] * aY[i]);
+    }
+    void raw_hypot(double* aResult, double const* aX, double const* aY, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = std::sqrt(aX[i] * aX[i] + aY[i] * aY[i]);
+    }
+
+    // kernel lazy_chain: lazy expression with every unit multiple folded into one coefficient
+    void quantity_lazy_chain(metre* __restrict aResult, kilometre const* aDistance, hour const* aTime, second const* aDuration, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = lazy(aDistance[i]) / aTime[i] * aDuration[i];
+    }
+    void raw_lazy_chain(double* __restrict aResult, double const* aDistance, double const* aTime, double const* aDuration, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aDistance[i] / aTime[i] * aDuration[i] * (1000.0 / 3600.0);
+    }
+
+    // kernel accessor_convert: converting_accessor reads and quantity_accessor writes over raw storage
+    void quantity_accessor_convert(double* aResult, double const* aInput, std::size_t aCount)
+    {
+        converting_accessor<metre, kilometre> const input;
+        quantity_accessor<metre> const result;
+        for (std::size_t i = 0; i < aCount; ++i)
+            result.access(aResult, i) = input.access(aInput, i);
+    }
+    void raw_accessor_convert(double* aResult, double const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aInput[i] * 1000.0;
+    }
+
+    // kernel records: convert_records with per field factors folded at compile time
+    void quantity_records(si_record* aResult, imperial_record const* aInput, std::size_t aCount)
+    {
+        convert_records(std::span{ aInput, aCount }, std::span{ aResult, aCount });
+    }
+    void raw_records(raw_record* aResult, raw_record const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = raw_record{ aInput[i].altitude * 0.3048, aInput[i].velocity * (1609.344 / 3600.0), aInput[i].mass * 0.45359237 };
+    }
+
+    // kernel rest_energy: m * c * c in MeV, the exact constant ratios folded into one factor
+    void quantity_rest_energy(megaelectronvolt* aResult, kilogram const* aMass, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = conversion_cast<megaelectronvolt>(aMass[i] * constants::speed_of_light * constants::speed_of_light);
+    }
+    void raw_rest_energy(double* aResult, double const* aMass, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aMass[i] * (299792458.0 * 299792458.0 / 1.602176634e-13);
+    }
+
+    // kernel kibibytes: integer B -> KiB, a shift rather than a division through floating point
+    void quantity_kibibytes(KiB<std::uint64_t>* aResult, B<std::uint64_t> const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = conversion_cast<KiB<std::uint64_t>>(aInput[i]);
+    }
+    void raw_kibibytes(std::uint64_t* aResult, std::uint64_t const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aResult[i] = aInput[i] >> 10;
+    }
+
+    // kernel atomic_add: relaxed atomic accumulation of KiB into a byte count
+    void quantity_atomic_add(atomic_quantity<B<std::uint64_t>>& aTotal, KiB<std::uint64_t> const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aTotal.fetch_add(aInput[i], std::memory_order_relaxed);
+    }
+    void raw_atomic_add(std::atomic<std::uint64_t>& aTotal, std::uint64_t const* aInput, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+            aTotal.fetch_add(aInput[i] << 10, std::memory_order_relaxed);
+    }
+}
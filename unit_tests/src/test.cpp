@@ -4,9 +4,33 @@
 #include <type_traits>
 #include <cmath>
 #include <iostream>
+#include <vector>
+#include <span>
+#include <thread>
 #include <neounit/neounit.hpp>
 #include <neounit/astronomical.hpp>
 #include <neounit/imperial.hpp>
+#include <neounit/logarithmic.hpp>
+#include <neounit/trigonometry.hpp>
+#include <neounit/math.hpp>
+#include <neounit/expression.hpp>
+#include <neounit/mdspan.hpp>
+#include <neounit/record.hpp>
+#include <neounit/statistics.hpp>
+#include <neounit/lut.hpp>
+#include <neounit/ode.hpp>
+#include <neounit/constants.hpp>
+#include <neounit/information.hpp>
+#include <neounit/atomic.hpp>
+#include <neounit/float16.hpp>
+#include <neounit/codec.hpp>
+#include <neounit/batch.hpp>
+#include <neounit/wire.hpp>
+#include <neounit/packed.hpp>
+#include <neounit/arrow.hpp>
+#include <neounit/ranges.hpp>
+#include <neounit/instrument.hpp>
+#include <neounit/unit_table.hpp>
 
 namespace
 {
@@ -40,6 +64,90 @@ namespace
 //#define STATIC_CHECK_4
 //#define STATIC_CHECK_5
 //#define STATIC_CHECK_6
+//#define STATIC_CHECK_7
+//#define STATIC_CHECK_8
+//#define STATIC_CHECK_9
+//#define STATIC_CHECK_10
+//#define STATIC_CHECK_11
+//#define STATIC_CHECK_12
+
+namespace
+{
+    template <typename Lhs, typename Rhs>
+    concept addable = requires (Lhs const& aLhs, Rhs const& aRhs) { aLhs + aRhs; };
+
+    void test_exact_literals()
+    {
+        using namespace neounit;
+        using namespace neounit::si::literals::exact;
+        using namespace neounit::imperial::literals::exact;
+
+        constexpr si::m<1, int> tenthKilometre = 0.1_km;
+        constexpr si::m<1> tenthKilometreDouble = 0.1_km;
+        constexpr si::mm<1, std::int64_t> mileInMillimetres = 1_mi;
+        constexpr si::s<1, int> twoHoursAgo = -2_h;
+        constexpr si::B<std::uint64_t> page = 4_KiB;
+#ifdef STATIC_CHECK_10
+        constexpr si::m<1, int> bad10 = 1.5_mm; // compilation failure if enabled
+#endif
+        static_assert(static_cast<int>(tenthKilometre) == 100);
+        static_assert(static_cast<double>(tenthKilometreDouble) == 100.0);
+        static_assert(static_cast<std::int64_t>(mileInMillimetres) == 1609344);
+        static_assert(static_cast<int>(twoHoursAgo) == -7200);
+        static_assert(static_cast<std::uint64_t>(page) == 4096u);
+        static_assert(static_cast<double>(si::MiB<>{ 1.5_GiB }) == 1536.0);
+        static_assert(static_cast<int>(si::mg<1, int>{ 2.5_g }) == 2500);
+        static_assert(static_cast<double>(conversion_cast<si::metre>(1.5e-3_km)) == 1.5);
+        static_assert(static_cast<double>(conversion_cast<si::metre>(0x10_km)) == 16000.0);
+        static_assert(static_cast<double>(conversion_cast<si::kilometre>(1'000'000_mm)) == 1.0);
+        static_assert(static_cast<double>(si::metre{ 05.5_m }) == 5.5 && static_cast<double>(si::metre{ 010e1_m }) == 100.0 && static_cast<int>(si::m<1, int>{ 010_m }) == 8);
+        test_assert(static_cast<int>(tenthKilometre) == 100);
+    }
+
+    struct flight_imperial
+    {
+        neounit::imperial::foot altitude;
+        decltype(neounit::imperial::mile{} / neounit::si::hour{}) speed;
+        neounit::imperial::pound mass;
+    };
+
+    struct flight_si
+    {
+        neounit::si::metre altitude;
+        decltype(neounit::si::metre{} / neounit::si::second{}) speed;
+        neounit::si::kilogram mass;
+    };
+
+    struct sample
+    {
+        neounit::si::kilometre distance;
+        int flags;
+        neounit::si::second duration;
+    };
+
+    struct sample_si
+    {
+        neounit::si::metre distance;
+        neounit::si::millisecond duration;
+    };
+
+    using velocity_type = decltype(neounit::si::metre{} / neounit::si::second{});
+
+    struct oscillator
+    {
+        neounit::si::metre position;
+        velocity_type velocity;
+    };
+
+    struct oscillator_rate
+    {
+        velocity_type velocity;
+        decltype(velocity_type{} / neounit::si::second{}) acceleration;
+    };
+}
+
+template <>
+struct neounit::record_fields<sample> { using type = fields<&sample::distance, &sample::duration>; };
 
 int main()
 {
@@ -63,6 +171,9 @@ int main()
     using namespace neounit::si;
     using namespace neounit::si::literals;
 
+    static_assert(std::is_trivially_copyable_v<si::metre>);
+    test_assert(near_enough(static_cast<double>(9.0_m / 2.0_s), 4.5));
+
     auto d0 = 1.0_us;
     inv_us foo;
     inv_Ms bar;
@@ -303,6 +414,9 @@ int main()
     test_assert(near_enough(conversion_cast<parsec_per_s>(hpps) / pps, 1000.0));
     auto oneQuettaParsec = 1.0_Qpc;
     test_assert(near_enough(conversion_cast<parsec>(oneQuettaParsec), 1e30, 1e15));
+    test_assert(near_enough(parallax_distance(0.5_arcsec), 2.0));
+    test_assert(near_enough(parallax_distance(10.0_marcsec), 100.0));
+    test_assert(near_enough(parallax(conversion_cast<metre>(4.0_pc)), 0.25));
 
     // imperial, just for fun. where's my pint?
 
@@ -352,4 +466,558 @@ int main()
     auto oneImperialMegaton = 1.0_Mt_;
     auto oneImperialMegatonInKilotons = conversion_cast<imperial::kiloton>(oneImperialMegaton);
     test_assert(near_enough(oneImperialMegatonInKilotons, 1000.0));
+
+    // literals
+
+    static_assert(std::is_same_v<decltype(5_km), decltype(5.0_km)>);
+    static_assert(static_cast<double>(5_km) == 5.0);
+    static_assert(static_cast<double>(conversion_cast<metre>(0.25_km)) == 250.0);
+    test_exact_literals();
+
+    // logarithmic
+
+    using namespace neounit::logarithmic;
+    using namespace neounit::logarithmic::literals;
+
+    auto rxPower = to_level<decibel_milliwatt>(1.0_W);
+    auto amplified = rxPower + 3.0_dB;
+    auto gain = amplified - rxPower;
+#ifdef STATIC_CHECK_7
+    auto bad7 = rxPower + rxPower; // compilation failure if enabled
+#endif
+    static_assert(std::is_same_v<decltype(amplified), decibel_milliwatt>);
+    static_assert(!addable<decibel_milliwatt, decibel_milliwatt> && addable<decibel_milliwatt, decibel>);
+    static_assert(std::is_same_v<decltype(gain), decibel>);
+    static_assert(std::is_same_v<decltype(to_linear(amplified)), decibel_milliwatt::reference_type>);
+    test_assert(near_enough(static_cast<double>(rxPower), 30.0));
+    test_assert(near_enough(conversion_cast<watt>(to_linear(amplified)), 1.9952623));
+    test_assert(near_enough(static_cast<double>(gain), 3.0));
+    test_assert(near_enough(static_cast<double>(conversion_cast<decibel_watt>(rxPower)), 0.0));
+    test_assert(near_enough(static_cast<double>(conversion_cast<decibel>(1.0_Np)), 8.6858896));
+    test_assert(near_enough(static_cast<double>(rxPower + 1.0_Np), 38.6858896));
+    test_assert(near_enough(to_linear<power_quantity>(3.0_dB), 1.9952623));
+    test_assert(near_enough(to_linear<root_power_quantity>(6.0_dB), 1.9952623));
+    test_assert(near_enough(static_cast<double>(to_log_ratio<decibel, power_quantity>(100.0)), 20.0));
+    test_assert(near_enough(static_cast<double>(to_level<decibel_microvolt>(1.0_V)), 120.0));
+
+    std::vector<watt> linearPowers;
+    for (int i = -200; i <= 200; ++i)
+        linearPowers.push_back(std::pow(10.0, i / 17.0));
+    std::vector<decibel_milliwatt> powerLevels(linearPowers.size());
+    to_level(std::span{ linearPowers }, std::span{ powerLevels });
+    std::vector<watt> roundTrip(powerLevels.size());
+    to_linear(std::span{ powerLevels }, std::span{ roundTrip });
+    for (std::size_t i = 0; i < linearPowers.size(); ++i)
+    {
+        test_assert(near_enough(static_cast<double>(powerLevels[i]), 10.0 * std::log10(linearPowers[i]) + 30.0, 1e-9));
+        test_assert(near_enough(roundTrip[i] / linearPowers[i], 1.0, 1e-9));
+    }
+
+    // angles
+
+    auto rightAngle = 90.0_deg;
+    auto quarterTurn = 0.25_tr;
+#ifdef STATIC_CHECK_8
+    auto bad8 = neounit::si::sin(1.0_m); // compilation failure if enabled
+#endif
+    static_assert(std::is_same_v<decltype(1.0_rad * 1.0_rad), steradian>);
+    static_assert(std::is_same_v<decltype(1.0_rad / 1.0_rad), double>);
+    static_assert(std::is_same_v<decltype(1.0_cd * 1.0_sr), lumen>);
+    static_assert(std::is_same_v<decltype(1.0_lm / (1.0_m * 1.0_m)), lux>);
+    test_assert(conversion_cast<decltype(1.0_cd)>(3.0_lm / 1.5_sr) == 2.0_cd);
+    test_equality(derived_unit_to_string(1.0_cd * 1.0_sr), "lm");
+    test_equality(derived_unit_to_string(1.0_klx), "klx");
+    test_assert(near_enough(conversion_cast<lumen>(2.0_cd * 1.0_arcmin * 1.0_arcmin) / 1.6923189988150474e-07, 1.0, 1e-14));
+    test_assert(near_enough(conversion_cast<radian>(rightAngle), 1.5707963267948966, 1e-15));
+    test_assert(near_enough(conversion_cast<degree>(quarterTurn), 90.0, 1e-12));
+    test_assert(near_enough(conversion_cast<arcsecond>(1.0_deg), 3600.0, 1e-9));
+    test_assert(near_enough(conversion_cast<arcminute>(1.0_tr), 21600.0, 1e-9));
+    test_assert(near_enough(conversion_cast<steradian>(1.0_arcsec * 1.0_arcsec) / 2.3504430539097885e-11, 1.0, 1e-14));
+    test_assert(near_enough(conversion_cast<steradian>(1.0_arcmin * 1.0_arcmin) / 8.461594994075237e-08, 1.0, 1e-14));
+    test_assert(near_enough(conversion_cast<steradian>(canonical(1.0_deg) * canonical(1.0_arcsec)) / 8.461594994075239e-08, 1.0, 1e-14));
+    test_assert(near_enough(conversion_cast<decltype(1.0_rad * 1.0_rad * 1.0_rad)>(1.0_deg * 1.0_deg * 1.0_deg) / 5.316576934207788e-06, 1.0, 1e-14));
+    test_assert(sin(180.0_deg) == 0.0);
+    test_assert(cos(rightAngle) == 0.0);
+    test_assert(cos(0.5_tr) == -1.0);
+    test_assert(sin(quarterTurn) == 1.0);
+    test_assert(near_enough(sin(30.0_deg), 0.5, 1e-15));
+    test_assert(near_enough(cos(-60.0_deg), 0.5, 1e-15));
+    test_assert(near_enough(sin(1.0_rad), std::sin(1.0), 1e-15));
+    test_assert(near_enough(sin(1.0_mrad), std::sin(1e-3), 1e-15));
+    test_equality(base_units_to_string(1.0_marcsec), "marcsec");
+    test_equality(base_units_to_u8string(1.0_karcsec), u8"k″");
+    static_assert(neounit::si::detail::units_per_turn_v<ratio_multiply<arcsecond_ratio, kilo>> == 1296 && neounit::si::detail::units_per_turn_v<ratio_multiply<arcsecond_ratio, milli>> == 1296000000);
+    test_assert(sin(324.0_karcsec) == 1.0);
+    auto const [sin45, cos45] = sincos(2700.0_arcmin);
+    test_assert(near_enough(sin45, std::sqrt(0.5), 1e-15) && near_enough(cos45, std::sqrt(0.5), 1e-15));
+    test_assert(near_enough(atan2(1.0_m, 1.0_m), 0.78539816339744831, 1e-15));
+    test_assert(near_enough(atan2<degree>(-1.0_m, 0.0_m), -90.0, 1e-12));
+
+    std::vector<degree> degrees;
+    std::vector<radian> radians;
+    for (int i = -2000; i <= 2000; ++i)
+    {
+        degrees.push_back(i * 0.37);
+        radians.push_back(i * 0.0123);
+    }
+    std::vector<double> sines(degrees.size());
+    std::vector<double> cosines(degrees.size());
+    sincos(std::span{ degrees }, std::span{ sines }, std::span{ cosines });
+    for (std::size_t i = 0; i < degrees.size(); ++i)
+    {
+        test_assert(near_enough(sines[i], std::sin(static_cast<double>(conversion_cast<radian>(degrees[i]))), 1e-14));
+        test_assert(near_enough(cosines[i], std::cos(static_cast<double>(conversion_cast<radian>(degrees[i]))), 1e-14));
+    }
+    sin(std::span{ radians }, std::span{ sines });
+    cos(std::span{ radians }, std::span{ cosines });
+    for (std::size_t i = 0; i < radians.size(); ++i)
+    {
+        test_assert(near_enough(sines[i], std::sin(static_cast<double>(radians[i])), 1e-15));
+        test_assert(near_enough(cosines[i], std::cos(static_cast<double>(radians[i])), 1e-15));
+    }
+
+    // math
+
+    auto area = 4.0_km * 9.0_km;
+    auto side = sqrt(area);
+    auto volume = pow<3>(3.0_m);
+#ifdef STATIC_CHECK_9
+    auto bad9 = sqrt(1.0_m); // compilation failure if enabled
+#endif
+    static_assert(std::is_same_v<decltype(side), kilometre>);
+    static_assert(std::is_same_v<decltype(cbrt(volume)), metre>);
+    static_assert(std::is_same_v<decltype(pow<-1>(2.0_s)), decltype(1.0 / 2.0_s)>);
+    static_assert(std::is_same_v<decltype(pow<0>(2.0_s)), double>);
+    test_assert(near_enough(side, 6.0));
+    test_assert(near_enough(cbrt(volume), 3.0));
+    test_assert(near_enough(pow<-2>(2.0_s), 0.25));
+    test_assert(hypot(3.0_m, 4.0_m) == 5.0_m);
+    test_assert(near_enough(hypot(1.0_m, 2.0_m, 2.0_m), 3.0));
+    test_assert(near_enough(hypot(1.0_m, 1.0_m, 1.0_m, 1.0_m), 2.0));
+    test_assert(near_enough(fma(2.0_m, 3.0_m, 1.0_m * 1.0_m), 7.0));
+    test_assert(near_enough(fma(2.0_s, 3.0_m / 1.0_s, 1.0_m), 7.0));
+    test_assert(near_enough(fma(2.0_s, 3.0_km / 1.0_s, 1.0_m), 6001.0));
+    test_assert(near_enough(fma(2.0_m, 2.0, 1.0_m), 5.0));
+    test_assert(abs(-2.5_m) == 2.5_m);
+    test_assert(floor(2.5_m) == 2.0_m && ceil(2.5_m) == 3.0_m && round(2.5_m) == 3.0_m && trunc(-2.5_m) == -2.0_m);
+
+    // expression
+
+    using metre_per_second = decltype(1.0_m / 1.0_s);
+    metre_per_second lazySpeed = lazy(36.0_km) / 1.0_h;
+    test_assert(near_enough(lazySpeed, 10.0));
+    test_assert(near_enough(conversion_cast<metre>(lazy(lazySpeed) * 2.0_h), 72000.0));
+    test_assert(near_enough(conversion_cast<kilometre>(lazy(3.0_km) * 2.0 / 4.0), 1.5));
+    test_assert(near_enough(conversion_cast<metre>(lazy(imperial::foot{ 1.0 }) * 1.0_km / 1.0_m), 304.8));
+    test_assert(near_enough(conversion_cast<decltype(1.0 / 1.0_s)>(2.0 / lazy(4.0_ms)), 500.0));
+    test_assert(near_enough((lazy(1.0_km) / 1.0_mm).evaluate<double>(), 1e6));
+    static_assert(static_cast<double>(metre{ lazy(3.0_m) * 2.0 }) == 6.0);
+#ifdef STATIC_CHECK_11
+    metre bad11 = lazy(1.0_m) / 1.0_s; // compilation failure if enabled
+#endif
+
+    // canonical
+
+    static_assert(std::is_same_v<canonical_t<newton>, canonical_t<decltype(1.0_kg * 1.0_m / (1.0_s * 1.0_s))>>);
+    static_assert(std::is_same_v<decltype(canonical(2.0_km) * canonical(3.0_km) / canonical(1.0_km)), canonical_t<kilometre>>);
+    static_assert(std::is_same_v<decltype(sqrt(canonical(4.0_km) * canonical(9.0_km))), canonical_t<kilometre>>);
+    static_assert(!std::is_same_v<decltype(1.0_km * 1.0_ms), decltype(1.0_m * 1.0_s)>);
+    static_assert(std::is_same_v<decltype(canonical(1.0_km) * canonical(1.0_ms)), decltype(canonical(1.0_m) * canonical(1.0_s))>);
+    constexpr canonical_t<kilometre> canonicalDistance = 2.0_km;
+    static_assert(static_cast<double>(conversion_cast<metre>(canonicalDistance)) == 2000.0);
+    test_assert(near_enough(conversion_cast<decltype(1.0_m * 1.0_m)>(canonical(2.0_km) * 3.0_m), 6000.0));
+    test_assert(near_enough(conversion_cast<decltype(1.0_m * 1.0_m)>(canonical(imperial::foot{ 1.0 }) * 2.0_m), 0.6096));
+    test_assert(near_enough(conversion_cast<decltype(1.0_m / 1.0_s)>(canonical(36.0_km) / 1.0_h), 10.0));
+    test_assert(near_enough(canonical(1.0_km) / 1.0_mm, 1e6));
+    test_assert(near_enough(conversion_cast<metre>(sqrt(canonical(imperial::foot{ 1.0 }) * imperial::foot{ 4.0 })), 0.6096));
+    kilometre fromCanonical = canonical(1.5_km);
+    test_assert(fromCanonical == 1.5_km);
+
+    // mdspan
+
+    std::vector<double> grid(3 * 4, 1.0);
+    quantity_accessor<kelvin> gridAccessor;
+    quantity_accessor<kelvin const> constGridAccessor = gridAccessor;
+    gridAccessor.access(grid.data(), 1 * 4 + 2) = kelvin{ 5.0 };
+    gridAccessor.access(gridAccessor.offset(grid.data(), 4), 3) += kelvin{ 2.0 };
+    test_assert(constGridAccessor.access(grid.data(), 6) == kelvin{ 5.0 });
+    test_assert(grid[7] == 3.0);
+    converting_accessor<metre, kilometre> toMetres;
+    test_assert(toMetres.access(grid.data(), 6) == 5000.0_m);
+    std::vector<double> const rod{ 1.0, 2.0, 4.0, 8.0, 16.0 };
+    std::vector<double> curvature(rod.size(), 0.0);
+    quantity_accessor<kelvin const> rodAccessor;
+    for (std::size_t i = 1; i + 1 < rod.size(); ++i)
+        gridAccessor.access(curvature.data(), i) = rodAccessor.access(rod.data(), i - 1) + rodAccessor.access(rod.data(), i + 1) - rodAccessor.access(rod.data(), i) * 2.0;
+    test_assert(curvature[1] == 1.0 && curvature[2] == 2.0 && curvature[3] == 4.0);
+    static_assert(std::is_same_v<decltype(rodAccessor.access(rod.data(), 0) * rodAccessor.access(rod.data(), 1)), decltype(1.0_K * 1.0_K)>);
+    test_assert(rodAccessor.access(rod.data(), 1) < rodAccessor.access(rod.data(), 2) && -rodAccessor.access(rod.data(), 0) == kelvin{ -1.0 });
+    test_assert(2.0 * rodAccessor.access(rod.data(), 1) == gridAccessor.access(curvature.data(), 3) && rodAccessor.access(rod.data(), 4) / 4.0 >= 4.0_K);
+#ifdef __cpp_lib_mdspan
+    quantity_mdspan<kelvin, std::dextents<std::size_t, 2>> field{ grid.data(), 3, 4 };
+    field[2, 1] += kelvin{ 1.0 };
+    test_assert(grid[9] == 2.0);
+    converting_mdspan<metre, kilometre, std::dextents<std::size_t, 2>> fieldInMetres{ grid.data(), 3, 4 };
+    test_assert(fieldInMetres[1, 2] == 5000.0_m);
+#endif
+
+    // records
+
+    std::vector<flight_imperial> imperialFlights(2, flight_imperial{ imperial::foot{ 1000.0 }, decltype(imperial::mile{} / hour{}){ 60.0 }, imperial::pound{ 2.0 } });
+    std::vector<flight_si> siFlights(2);
+    convert_records(std::span{ imperialFlights }, std::span{ siFlights });
+    test_assert(near_enough(siFlights[1].altitude, 304.8));
+    test_assert(near_enough(siFlights[1].speed, 26.8224));
+    test_assert(near_enough(siFlights[1].mass, 0.90718474));
+    auto const converted = convert_record<sample_si>(sample{ 1.5_km, 7, 2.0_s });
+    test_assert(converted.distance == 1500.0_m && near_enough(converted.duration, 2000.0));
+
+    // statistics
+
+    std::vector<metre> samples;
+    for (int i = 1; i <= 10; ++i)
+        samples.push_back(metre{ static_cast<double>(i) });
+    running_statistics<metre> lower, upper, bulk;
+    for (std::size_t i = 0; i < 5; ++i)
+        lower.add(samples[i]);
+    for (std::size_t i = 5; i < samples.size(); ++i)
+        upper.add(samples[i]);
+    lower.merge(upper);
+    bulk.add(std::span<metre const>{ samples });
+    static_assert(std::is_same_v<decltype(lower.variance()), decltype(1.0_m * 1.0_m)>);
+    static_assert(std::is_same_v<decltype(lower.standard_deviation()), metre>);
+    test_assert(lower.count() == 10u && near_enough(lower.mean(), 5.5) && near_enough(lower.variance(), 55.0 / 6.0));
+    test_assert(near_enough(bulk.variance(), 55.0 / 6.0) && bulk.minimum() == 1.0_m && bulk.maximum() == 10.0_m);
+    ewma<metre> smoothed{ 0.5 };
+    smoothed.add(2.0_m);
+    smoothed.add(4.0_m);
+    test_assert(smoothed.value() == 3.0_m);
+    quantile_sketch<metre> sketch;
+    for (auto const& sample : samples)
+        sketch.add(sample * 100.0);
+    test_assert(std::abs(static_cast<double>(sketch.quantile(0.5)) - 500.0) <= 5.0);
+    histogram<metre> bins{ 0.0_m, 10.0_m, 5 };
+    bins.add(std::span<metre const>{ samples });
+    test_assert(bins.edge(1) == 2.0_m && bins.count(0) == 1u && bins.count(4) == 2u && bins.overflow() == 1u);
+    bins.add(metre{ std::numeric_limits<double>::quiet_NaN() });
+    bins.add(metre{ -std::numeric_limits<double>::infinity() });
+    test_assert(bins.nans() == 1u && bins.underflow() == 1u && bins.overflow() == 1u);
+    sketch.add(metre{ std::numeric_limits<double>::infinity() });
+    sketch.add(metre{ -std::numeric_limits<double>::infinity() });
+    sketch.add(metre{ std::numeric_limits<double>::quiet_NaN() });
+    test_assert(sketch.count() == 12u && sketch.nans() == 1u);
+    test_assert(sketch.quantile(1.0) == metre{ std::numeric_limits<double>::infinity() } && sketch.quantile(0.0) == metre{ -std::numeric_limits<double>::infinity() });
+    test_assert(std::abs(static_cast<double>(sketch.quantile(0.5)) - 500.0) <= 5.0);
+
+    // lookup tables
+
+    std::vector<kelvin> const temperatures{ 0.0_K, 10.0_K, 20.0_K, 30.0_K };
+    std::vector<kelvin> const unevenTemperatures{ 0.0_K, 5.0_K, 20.0_K, 30.0_K };
+    std::vector<ohm> const resistances{ ohm{ 100.0 }, ohm{ 110.0 }, ohm{ 130.0 }, ohm{ 160.0 } };
+    uniform_lut<kelvin, ohm> const resistance{ 0.0_K, 30.0_K, resistances };
+    uniform_lut<kelvin, ohm, interpolation::cubic> const smoothResistance{ 0.0_K, 30.0_K, resistances };
+    lut<kelvin, ohm> const unevenResistance{ unevenTemperatures, resistances };
+    lut<kelvin, ohm, interpolation::cubic> const smoothUnevenResistance{ temperatures, resistances };
+    test_assert(resistance(15.0_K) == ohm{ 120.0 } && near_enough(resistance(millikelvin{ 15000.0 }), 120.0));
+    test_assert(resistance(-5.0_K) == ohm{ 100.0 } && resistance(40.0_K) == ohm{ 160.0 });
+    test_assert(smoothResistance(10.0_K) == ohm{ 110.0 } && near_enough(smoothResistance(15.0_K), 118.75));
+    test_assert(near_enough(smoothUnevenResistance(15.0_K), 118.75));
+    test_assert(unevenResistance(2.5_K) == ohm{ 105.0 } && unevenResistance(12.5_K) == ohm{ 120.0 } && unevenResistance(25.0_K) == ohm{ 145.0 });
+    std::vector<ohm> looked(temperatures.size());
+    resistance(std::span{ temperatures }, std::span{ looked });
+    test_assert(looked == resistances);
+
+    // ODE integration
+
+    auto const spring = [](auto const&, oscillator const& aState) { return oscillator_rate{ aState.velocity, aState.position / (1.0_s * 1.0_s) * -1.0 }; };
+    auto const swung = rk4(spring, 0.0_s, oscillator{ 1.0_m, velocity_type{} }, 10.0_ms, 100u);
+    test_assert(near_enough(swung.position, std::cos(1.0)) && near_enough(swung.velocity, -std::sin(1.0)));
+    auto const swungTuple = rk4([](second, std::tuple<metre, velocity_type> const& aState)
+        { return std::tuple{ std::get<1>(aState), std::get<0>(aState) / (1.0_s * 1.0_s) * -1.0 }; },
+        0.0_s, std::tuple{ 1.0_m, velocity_type{} }, 0.01_s, 100u);
+    test_assert(near_enough(std::get<0>(swungTuple), std::cos(1.0)));
+    auto const adaptive = dormand_prince(spring, 0.0_s, oscillator{ 1.0_m, velocity_type{} }, 1.0_s, 0.1_s, 1e-9, oscillator{ metre{ 1e-12 }, velocity_type{ 1e-12 } });
+    test_assert(adaptive.time == 1.0_s && near_enough(adaptive.state.position, std::cos(1.0), 1e-8));
+    state_array<oscillator> oscillators(3u);
+    for (std::size_t i = 0; i < oscillators.size(); ++i)
+        oscillators.set(i, oscillator{ metre{ static_cast<double>(i) }, velocity_type{} });
+    oscillators.rk4(spring, 0.0_s, 0.01_s, 100u);
+    test_assert(near_enough(oscillators.get(2).position, 2.0 * std::cos(1.0)));
+#ifdef STATIC_CHECK_12
+    rk4([](second, oscillator const& aState) { return oscillator{ aState.position, aState.velocity }; }, 0.0_s, oscillator{}, 0.01_s, 1u); // compilation failure if enabled
+#endif
+
+    // physical constants
+
+    {
+        using namespace si::constants::symbols;
+        constexpr megaelectronvolt electronRestEnergy = conversion_cast<megaelectronvolt>(m_e * c * c);
+        test_assert(near_enough(electronRestEnergy, 0.51099895));
+        static_assert(std::is_same_v<decltype(c * c * 1.0_kg)::ratios_type, magnitude<ratio<89875517873681764, 1, 3>>>);
+        test_assert(near_enough(conversion_cast<joule>(1.0_kg * c * c), 89875517873681764.0, 1.0));
+        test_assert(near_enough(conversion_cast<decltype(joule{} / (kelvin{} * mole{}))>(R), 8.314462618));
+        test_assert(near_enough(conversion_cast<coulomb>(e) * 1e19, 1.602176634));
+        test_assert(near_enough(conversion_cast<joule>(electronvolt{ 1.0 }) * 1e19, 1.602176634));
+        test_assert(near_enough(conversion_cast<newton>(G * 1.0_kg * 1.0_kg / (1.0_m * 1.0_m)) * 1e11, 6.6743));
+    }
+
+    // information
+
+    using bytes = B<std::uint64_t>;
+    using kibibytes = KiB<std::uint64_t>;
+    static_assert(conversion_cast<bytes>(kibibytes{ std::uint64_t{ 3 } }) == 3072u);
+    static_assert(conversion_cast<kibibytes>(bytes{ std::uint64_t{ 3071 } }) == 2u);
+    static_assert(conversion_cast<kibibytes>(GiB<std::uint64_t>{ std::uint64_t{ 5 } }) == 5u << 20);
+    static_assert(conversion_cast<bytes>(kB<std::uint64_t>{ std::uint64_t{ 2 } }) == 2000u);
+    static_assert(conversion_cast<bytes>(b<std::uint64_t>{ std::uint64_t{ 17 } }) == 2u);
+    static_assert(conversion_cast<m<1, int>>(km<1, int>{ -3 }) == -3000 && conversion_cast<km<1, int>>(m<1, int>{ 2500 }) == 2);
+    test_assert(conversion_cast<byte>(1.0_Kib) == 128.0_B);
+    test_assert(conversion_cast<mebibyte>(1.0_MB) == mebibyte{ 1e6 / 1048576.0 });
+    auto const throughput = 3.0_GiB / 2.0_s;
+    test_assert(conversion_cast<decltype(mebibyte{} / second{})>(throughput) == 1536.0_MiB / 1.0_s);
+    test_assert(near_enough(conversion_cast<decltype(bit{} / millisecond{})>(throughput), 12884901.888));
+    test_equality(base_units_to_string(throughput), "s^-1 GiB");
+    test_equality(base_units_to_string(1.0_Mb), "Mbit");
+
+    // atomic quantities
+
+    atomic_quantity<joule> energy;
+    static_assert(atomic_quantity<joule>::is_always_lock_free);
+    test_assert(energy.fetch_add(1500.0_J) == 0.0_J && energy.load() == 1500.0_J);
+    test_assert((energy -= 500.0_J) == 1000.0_J);
+    auto expectedEnergy = 1000.0_J;
+    test_assert(energy.compare_exchange_strong(expectedEnergy, 2.0_J) && !energy.compare_exchange_strong(expectedEnergy, 3.0_J) && expectedEnergy == 2.0_J);
+    atomic_quantity<second> elapsed;
+    elapsed += 250.0_ms;
+    test_assert(near_enough(elapsed.fetch_sub(1.0_ms), 0.25) && near_enough(elapsed.load(), 0.249));
+    atomic_quantity<bytes> transferred;
+    transferred.fetch_add(kibibytes{ std::uint64_t{ 2 } });
+    test_assert(transferred.load() == 2048u);
+    sharded_accumulator<bytes> received(4u);
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 8; ++worker)
+        workers.emplace_back([&]() { for (int i = 0; i < 1000; ++i) received.add(kibibytes{ std::uint64_t{ 1 } }); });
+    for (auto& worker : workers)
+        worker.join();
+    test_assert(received.shards() == 4u && received.value() == 8u * 1000u * 1024u);
+    test_assert(received.reset() == 8192000u && received.value() == 0u);
+
+    // reduced precision storage
+
+    static_assert(float16{ 1.0f }.bits() == 0x3C00u && float16{ 65504.0f }.bits() == 0x7BFFu && float16{ 65520.0f }.bits() == 0x7C00u);
+    static_assert(float16{ 1.0f + 0x1p-11f }.bits() == 0x3C00u && float16{ 1.0f + 0x1p-10f + 0x1p-11f }.bits() == 0x3C02u);
+    static_assert(float16{ 0x1p-24f }.bits() == 0x0001u && float16{ 0x1p-25f }.bits() == 0x0000u && float{ float16::from_bits(0x0001u) } == 0x1p-24f);
+    static_assert(bfloat16{ 1.0f }.bits() == 0x3F80u && float{ bfloat16{ 3.0e38f } } > 2.9e38f);
+    using metre_f16 = m<1, float16>;
+    constexpr metre_f16 halfMetre{ float16{ 0.5f } };
+    static_assert(sizeof(metre_f16) == 2u);
+    static_assert(static_cast<float>(static_cast<float16>(halfMetre * float16{ 3.0f } + halfMetre)) == 2.0f);
+    test_assert(static_cast<float>(static_cast<float16>(conversion_cast<mm<1, float16>>(halfMetre))) == 500.0f);
+    test_assert(widen(halfMetre) == m<1, float>{ 0.5f } && narrow<float16>(m<1, float>{ 0.1f }) == metre_f16{ float16{ 0.0999755859375f } });
+    std::vector<m<1, float>> wide(19);
+    for (std::size_t i = 0; i < wide.size(); ++i)
+        wide[i] = 0.25f * static_cast<float>(i);
+    std::vector<metre_f16> narrowed(wide.size());
+    pack(std::span<m<1, float> const>{ wide }, std::span{ narrowed });
+    std::vector<m<1, float>> widened(wide.size());
+    unpack(std::span{ narrowed }, std::span{ widened });
+    test_assert(widened == wide);
+
+    // time series codec
+
+    static_assert(descriptor_of<km<1>>() == descriptor_of(canonical(1.0_km)) && descriptor_of<km<1>>().exp == 3);
+    static_assert(descriptor_of<kibibytes>().num == 1024 && descriptor_of<kibibytes>().same_dimensions(descriptor_of<bytes>()));
+    test_assert(conversion_factor(descriptor_of<km<1>>(), descriptor_of<m<1>>()) == 1000.0);
+    std::vector<s<1, std::int64_t>> ticks(10000);
+    for (std::size_t i = 0; i < ticks.size(); ++i)
+        ticks[i] = static_cast<std::int64_t>(1700000000000 + i * 1000 + (i % 7 == 0 ? 1 : 0));
+    auto const tickStream = encode_series(std::span<s<1, std::int64_t> const>{ ticks });
+    test_assert(tickStream.size() * 6u < ticks.size() * sizeof(std::int64_t));
+    test_assert(decode_series<s<1, std::int64_t>>(tickStream) == ticks);
+    bool unitMismatch = false;
+    try { series_decoder<m<1, std::int64_t>>{ tickStream }; } catch (std::invalid_argument const&) { unitMismatch = true; }
+    test_assert(unitMismatch);
+    std::vector<mK<1>> readings(5000);
+    for (std::size_t i = 0; i < readings.size(); ++i)
+        readings[i] = 293150.0 + std::round(std::sin(static_cast<double>(i) * 0.01) * 5000.0) * 0.001;
+    test_assert(decode_series<mK<1>>(encode_series(std::span<mK<1> const>{ readings })) == readings);
+    auto const quantized = encode_series(std::span<mK<1> const>{ readings }, uK<1>{ 1.0 });
+    test_assert(quantized.size() * 4u < readings.size() * sizeof(double));
+    auto const dequantized = decode_series<mK<1>>(quantized);
+    test_assert(dequantized.size() == readings.size());
+    for (std::size_t i = 0; i < readings.size(); ++i)
+        test_assert(near_enough(static_cast<double>(dequantized[i]), static_cast<double>(readings[i]), 0.0005));
+    std::vector<std::byte> guardedStream;
+    {
+        series_encoder<mK<1>> guarded{ guardedStream, uK<1>{ 1.0 } };
+        int unrepresentable = 0;
+        for (double const value : { std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), 1.0e17, -1.0e17 })
+            try { guarded.append(mK<1>{ value }); } catch (std::domain_error const&) { ++unrepresentable; }
+        test_assert(unrepresentable == 5);
+        guarded.append(mK<1>{ 1.0e12 });
+        guarded.append(mK<1>{ -2.5 });
+        guarded.flush();
+    }
+    auto const guardedValues = decode_series<mK<1>>(guardedStream);
+    test_assert(guardedValues.size() == 2u && near_enough(static_cast<double>(guardedValues[0]), 1.0e12, 0.0005) && near_enough(static_cast<double>(guardedValues[1]), -2.5, 0.0005));
+
+    // batch conversion
+
+    batch_converter converter{ 3u, 4096u };
+    std::vector<imperial::mile> distances(100000);
+    for (std::size_t i = 0; i < distances.size(); ++i)
+        distances[i] = static_cast<double>(i % 100);
+    batch_buffer<km<1>> kilometres{ distances.size() };
+    auto const batch = converter.convert(std::span<imperial::mile const>{ distances }, kilometres.span());
+    test_assert(converter.threads() == 3u && batch.elements == distances.size() && converter.progress() == distances.size() && batch.chunks == 391u);
+    for (std::size_t i = 0; i < distances.size(); ++i)
+        test_assert(near_enough(static_cast<double>(kilometres[i]), static_cast<double>(i % 100) * 1.609344));
+    std::vector<double> rawMillimetres(1000, 2.5);
+    std::vector<double> rawMetres(rawMillimetres.size());
+    converter.convert(std::span<double const>{ rawMillimetres }, descriptor_of<mm<1>>(), std::span{ rawMetres }, descriptor_of<m<1>>());
+    test_assert(near_enough(rawMetres.front(), 0.0025) && near_enough(rawMetres.back(), 0.0025));
+    bool dimensionMismatch = false;
+    try { converter.convert(std::span<double const>{ rawMillimetres }, descriptor_of<mm<1>>(), std::span{ rawMetres }, descriptor_of<s<1>>()); } catch (std::invalid_argument const&) { dimensionMismatch = true; }
+    test_assert(dimensionMismatch);
+
+    // wire format
+
+    std::vector<std::byte> message;
+    std::vector<km<1>> legs = { 1.5, 2.25, 40.0 };
+    write_column(message, std::span<km<1> const>{ legs });
+    write_value(message, s<1>{ 90.0 });
+    test_assert(message.size() == 48u + 24u + 48u + 8u);
+    std::size_t position = 0u;
+    wire_view<m<1>> legsInMetres{ message, position };
+    wire_view<s<1>> duration{ message, position };
+    test_assert(position == message.size() && legsInMetres.size() == 3u && legsInMetres.converts() && !duration.converts());
+    test_assert(near_enough(static_cast<double>(legsInMetres[1]), 2250.0) && static_cast<double>(duration[0]) == 90.0);
+    test_assert(wire_view<km<1>>{ message }.to_vector() == legs);
+    test_assert(near_enough(static_cast<double>(wire_view<m<1>, km<1>>{ message }.to_vector()[2]), 40000.0));
+    bool wrongUnit = false;
+    try { wire_view<s<1>>{ message }; } catch (std::invalid_argument const&) { wrongUnit = true; }
+    test_assert(wrongUnit);
+    bool truncated = false;
+    try { wire_view<km<1>>{ std::span<std::byte const>{ message }.first(60u) }; } catch (std::invalid_argument const&) { truncated = true; }
+    test_assert(truncated);
+    std::vector<std::byte> counts;
+    std::vector<mm<1, std::int64_t>> offsets = { std::int64_t{ 2500 }, std::int64_t{ -1999 } };
+    write_column(counts, std::span<mm<1, std::int64_t> const>{ offsets });
+    std::vector<kibibytes> blocks = { std::uint64_t{ 3 } };
+    write_column(counts, std::span<kibibytes const>{ blocks });
+    std::vector<angle<degree_ratio, std::int32_t>> headings = { std::int32_t{ 90 } };
+    write_column(counts, std::span<angle<degree_ratio, std::int32_t> const>{ headings });
+    position = 0u;
+    wire_view<m<1, std::int64_t>> offsetsInMetres{ counts, position };
+    wire_view<bytes> blockBytes{ counts, position };
+    test_assert(offsetsInMetres.converts() && offsetsInMetres.to_vector() == std::vector<m<1, std::int64_t>>{ std::int64_t{ 2 }, std::int64_t{ -1 } });
+    test_assert(wire_view<um<1, std::int64_t>>{ counts }[1] == um<1, std::int64_t>{ std::int64_t{ -1999000 } });
+    test_assert(blockBytes[0] == bytes{ std::uint64_t{ 3072 } });
+    bool noIntegerScale = false;
+    try { wire_view<angle<one, std::int32_t>>{ counts, position }; } catch (std::invalid_argument const&) { noIntegerScale = true; }
+    test_assert(noIntegerScale);
+
+    // packed fields
+
+    using board_temperature = packed_quantity<std::int16_t, std::endian::big, centi, degC<>>;
+    using supply_voltage = packed_quantity<packed_uint24, std::endian::little, ratio<5, 1, -4>, V<>>;
+    std::vector<std::byte> packets(5u * 40u);
+    for (std::size_t i = 0; i < 40u; ++i)
+    {
+        auto const centidegrees = static_cast<std::uint16_t>(static_cast<std::int16_t>(i * 100u) - 2000);
+        packets[i * 5u + 0u] = static_cast<std::byte>(centidegrees >> 8);
+        packets[i * 5u + 1u] = static_cast<std::byte>(centidegrees & 0xFFu);
+        packets[i * 5u + 2u] = static_cast<std::byte>(i);
+        packets[i * 5u + 3u] = std::byte{ 0x27u };
+        packets[i * 5u + 4u] = std::byte{ 0x00u };
+    }
+    test_assert(near_enough(static_cast<double>(board_temperature::read(std::span<std::byte const>{ packets })), -20.0));
+    test_assert(near_enough(static_cast<double>(board_temperature::read<mK<1>>(std::span<std::byte const>{ packets }, 5u)), -19000.0));
+    test_assert(near_enough(static_cast<double>(supply_voltage::read(std::span<std::byte const>{ packets }, 2u)), 4.992));
+    std::vector<mK<1>> boardTemperatures(40u);
+    board_temperature::read_packets(std::span<std::byte const>{ packets }, std::span{ boardTemperatures }, 5u);
+    std::vector<V<>> supplyVoltages(40u);
+    supply_voltage::read_packets(std::span<std::byte const>{ packets }, std::span{ supplyVoltages }, 5u, 2u);
+    for (std::size_t i = 0; i < 40u; ++i)
+    {
+        test_assert(boardTemperatures[i] == board_temperature::read<mK<1>>(packets.data() + i * 5u));
+        test_assert(near_enough(static_cast<double>(supplyVoltages[i]), (9984.0 + static_cast<double>(i)) * 0.0005));
+    }
+    bool packetsTruncated = false;
+    try { board_temperature::read_packets(std::span<std::byte const>{ packets }.first(100u), std::span{ boardTemperatures }, 5u); } catch (std::invalid_argument const&) { packetsTruncated = true; }
+    test_assert(packetsTruncated);
+
+    // arrow columns
+
+    test_assert(unit_descriptor_from_string("km h^-1") == descriptor_of(1.0_km / 1.0_h));
+    test_assert(unit_descriptor_from_string(base_units_to_string(1.0_ohm)) == descriptor_of(1.0_ohm));
+    test_assert(unit_descriptor_from_string("s^-1 GiB") == descriptor_of(throughput));
+    std::vector<km<1>> route = { 1.0, 2.5, 4.0 };
+    ArrowArray routeArray;
+    ArrowSchema routeSchema;
+    export_arrow(std::span<km<1> const>{ route }, routeArray, routeSchema, "route");
+    test_assert(routeArray.buffers[1] == route.data() && routeArray.length == 3 && std::string_view{ routeSchema.format } == "g");
+    test_assert(arrow_unit(routeSchema) == descriptor_of<km<1>>());
+    arrow_view<km<1>> routeInKilometres{ routeArray, routeSchema };
+    arrow_view<m<1>> routeInMetres{ routeArray, routeSchema };
+    test_assert(!routeInKilometres.converts() && routeInKilometres.to_vector() == route);
+    test_assert(routeInMetres.converts() && near_enough(static_cast<double>(routeInMetres[1]), 2500.0));
+    bool routeMismatch = false;
+    try { arrow_view<s<1>>{ routeArray, routeSchema }; } catch (std::invalid_argument const&) { routeMismatch = true; }
+    test_assert(routeMismatch);
+    routeArray.release(&routeArray);
+    routeSchema.release(&routeSchema);
+    test_assert(routeArray.release == nullptr && routeSchema.release == nullptr);
+    bool inexactUnit = false;
+    try { export_arrow(std::vector<imperial::mile>(2u), routeArray, routeSchema); } catch (std::invalid_argument const&) { inexactUnit = true; }
+    test_assert(inexactUnit);
+    std::vector<marcsec> parallaxes = { 1.5, 20.0 };
+    export_arrow(std::span<marcsec const>{ parallaxes }, routeArray, routeSchema, "parallax");
+    test_assert(arrow_unit(routeSchema) == descriptor_of<marcsec>());
+    test_assert(near_enough(static_cast<double>(arrow_view<arcsecond>{ routeArray, routeSchema }[1]), 0.02, 1e-15));
+    routeArray.release(&routeArray);
+    routeSchema.release(&routeSchema);
+
+    // range adaptors
+
+    std::vector<double> rawMillimetreSamples = { 1000.0, 2500.0, 4000.0 };
+    auto const sampleLengths = rawMillimetreSamples | views::as_quantity<mm<1>> | views::convert_to<metre>;
+    static_assert(std::is_same_v<std::remove_const_t<decltype(sampleLengths)>, std::ranges::transform_view<std::ranges::ref_view<std::vector<double>>, neounit::detail::unit_transform<mm<1>, metre, false>>>);
+    static_assert(std::ranges::random_access_range<decltype(sampleLengths)> && std::ranges::sized_range<decltype(sampleLengths)>);
+    test_assert(sampleLengths.size() == 3u && near_enough(static_cast<double>(sampleLengths[1]), 2.5));
+    auto const toRawKilometres = views::as_quantity<mm<1>> | views::convert_to<km<1>> | views::strip_unit;
+    auto const rawKilometres = rawMillimetreSamples | toRawKilometres;
+    static_assert(std::is_same_v<std::ranges::range_value_t<decltype(rawKilometres)>, double>);
+    test_assert(near_enough(rawKilometres[2], 0.004));
+    test_assert(std::ranges::equal(route | views::convert_to<m<1>> | views::strip_unit, std::vector<double>{ 1000.0, 2500.0, 4000.0 }));
+
+    // conversion instrumentation
+
+    reset_conversion_counts();
+    neounit::detail::record_conversion<km<1>, m<1>>(1u);
+    neounit::detail::record_conversion<km<1>, m<1>>(4u);
+    neounit::detail::record_conversion<mm<1>, m<1>>(1u);
+    auto const hotConversions = conversion_counts();
+    test_assert(hotConversions.size() == 2u && hotConversions[0].from == "km" && hotConversions[0].to == "m");
+    test_assert(hotConversions[0].calls == 2u && hotConversions[0].elements == 5u && hotConversions[1].elements == 1u);
+    reset_conversion_counts();
+    test_assert(conversion_counts().empty());
+
+    // unit table
+
+    using units = named_unit_table;
+    auto const kilometreId = units::id_of<km<1>>();
+    auto const mileId = units::id_of(descriptor_of<imperial::mile>());
+    test_assert(units::id_of<Bq<>>() == units::id_of<Hz<>>());
+    test_assert(units::factor(kilometreId, units::id_of<metre>()) == 1000.0 && near_enough(units::factor(mileId, kilometreId), 1.609344));
+    std::vector<double> tableDistances = { 1.0, 2.0 };
+    units::convert(std::span<double const>{ tableDistances }, mileId, kilometreId, std::span{ tableDistances });
+    test_assert(near_enough(tableDistances[1], 3.218688));
+    test_assert(units::visit(mileId, [](auto aUnit) { return std::is_same_v<decltype(aUnit), imperial::mile>; }));
+    bool tableMismatch = false;
+    try { units::factor(kilometreId, units::id_of<s<1>>()); } catch (std::invalid_argument const&) { tableMismatch = true; }
+    test_assert(tableMismatch);
+    bool unknownUnit = false;
+    try { units::id_of(descriptor_of<km<2>>()); } catch (std::invalid_argument const&) { unknownUnit = true; }
+    test_assert(unknownUnit);
 }
\ No newline at end of file